@@ -171,9 +171,7 @@ void App::HandleKeyPressed()
             break;
 
         case false:
-            g_game->ResetData();
-            g_app->DeleteAndCreateNewGame();
-            g_game->SetAttractMode(true);
+            g_game->Reset();
             g_game->SetPlayerShipIsReadyToSpawnBullet(false);
 
             break;
@@ -201,8 +199,7 @@ void App::HandleKeyPressed()
     {
         if (g_input->WasKeyJustPressed(KEYCODE_F8))
         {
-            DeleteAndCreateNewGame();
-            g_game->SetAttractMode(true);
+            g_game->Reset();
             g_game->SetPlayerShipIsReadyToSpawnBullet(!false);
         }
     }
@@ -239,12 +236,3 @@ void App::AdjustForPauseAndTimeDistortion() const
         }
     }
 }
-
-//----------------------------------------------------------------------------------------------------
-void App::DeleteAndCreateNewGame()
-{
-    delete g_game;
-    g_game = nullptr;
-
-    g_game = new Game();
-}
@@ -35,7 +35,6 @@ private:
     void HandleKeyReleased();
     void HandleQuitRequested();
     void AdjustForPauseAndTimeDistortion() const;
-    void DeleteAndCreateNewGame();
 
     bool  m_isSlowMo           = false;
     float m_timeLastFrameStart = 0.f;
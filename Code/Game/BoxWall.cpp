@@ -0,0 +1,181 @@
+//----------------------------------------------------------------------------------------------------
+// BoxWall.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/BoxWall.hpp"
+//----------------------------------------------------------------------------------------------------
+#include "Game/MeshLibrary.hpp"
+#include "Game/RenderBatcher.hpp"
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Math/RandomNumberGenerator.hpp"
+//----------------------------------------------------------------------------------------------------
+#include <algorithm>
+
+//----------------------------------------------------------------------------------------------------
+BoxWall::BoxWall(MeshLibrary const* meshLibrary, RenderBatcher& batcher)
+{
+    m_boxMeshIndex = batcher.RegisterMesh(meshLibrary->GetBoxVerts(), BOX_VERTS_NUM, false);
+
+    // A column enters with its left edge at WORLD_SIZE_X; by the time its slot is reused it has stepped
+    // m_numColumns pitches left and its right edge is past x = 0
+    m_numColumns = static_cast<int>(std::ceil((WORLD_SIZE_X + BOX_SIDE_LENGTH) / BOX_WALL_PITCH));
+
+    float const bottomStackY = BOX_SIDE_LENGTH * 0.1f;
+    float const topStackY    = WORLD_SIZE_Y - BOX_WALL_PITCH;
+
+    for (int stackIndex = 0; stackIndex < BOX_WALL_STACK_HEIGHT; ++stackIndex)
+    {
+        m_rowBottoms[stackIndex]                         = bottomStackY + static_cast<float>(stackIndex) * BOX_WALL_PITCH;
+        m_rowBottoms[BOX_WALL_STACK_HEIGHT + stackIndex] = topStackY - static_cast<float>(stackIndex) * BOX_WALL_PITCH;
+    }
+
+    for (int row = 0; row < BOX_WALL_ROW_NUM; ++row)
+    {
+        m_rowCentersY[row] = m_rowBottoms[row] + BOX_SIDE_LENGTH / 2.f;
+        m_boxRadii[row]    = BOX_SIDE_LENGTH / 2.f;
+    }
+
+    m_cellHealth.resize(static_cast<size_t>(m_numColumns) * BOX_WALL_ROW_NUM);
+}
+
+//----------------------------------------------------------------------------------------------------
+// Eases the wall one pitch to the left over the first half of every step, then lets it rest.
+//
+void BoxWall::Update(float const deltaSeconds)
+{
+    m_stepTime += deltaSeconds;
+
+    float const t = GetClamped(m_stepTime / (BOX_WALL_STEP_SECONDS * 0.5f), 0.f, 1.f);
+
+    m_scrollOffset = Interpolate(m_scrollOffset, BOX_WALL_PITCH, t);
+
+    if (m_stepTime >= BOX_WALL_STEP_SECONDS)
+    {
+        m_stepTime = 0.f;
+        PushColumn();
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// Only the columns under the batcher's cull bounds are walked, so columns still sliding in from past
+// the right edge cost nothing.
+//
+void BoxWall::Render(RenderBatcher& batcher) const
+{
+    if (m_numBoxes == 0) return;
+
+    int numVisible = 0;
+
+    ForEachBoxOverlappingBounds(batcher.GetCullBounds(), [this, &batcher, &numVisible](sBoxWallCell const& cell)
+    {
+        batcher.AppendInstance(sRenderState(), m_boxMeshIndex, sShapeInstance{GetCellBounds(cell).m_mins, 0.f, 1.f, BOX_COLOR});
+        ++numVisible;
+    });
+
+    batcher.AddNumCulled(m_numBoxes - numVisible);
+}
+
+//----------------------------------------------------------------------------------------------------
+void BoxWall::DebugRender(RenderBatcher& batcher) const
+{
+    ForEachBoxOverlappingBounds(batcher.GetCullBounds(), [this, &batcher](sBoxWallCell const& cell)
+    {
+        DebugDrawBoxRing(batcher, GetCellBounds(cell).GetCenter(), BOX_SIDE_LENGTH / 2.f, 0.2f, DEBUG_RENDER_RED);
+    });
+}
+
+//----------------------------------------------------------------------------------------------------
+void BoxWall::Clear()
+{
+    std::fill(m_cellHealth.begin(), m_cellHealth.end(), static_cast<uint8_t>(0));
+
+    m_numLiveColumns = 0;
+    m_newestColumn   = 0;
+    m_numBoxes       = 0;
+    m_scrollOffset   = 0.f;
+    m_stepTime       = 0.f;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Every column already in the wall has finished its step, so the offset restarts at zero with the
+// new column at WORLD_SIZE_X and the others exactly one pitch further left than before.
+//
+void BoxWall::PushColumn()
+{
+    m_newestColumn   = (m_newestColumn + 1) % m_numColumns;
+    m_scrollOffset   = 0.f;
+    m_numLiveColumns = m_numLiveColumns < m_numColumns ? m_numLiveColumns + 1 : m_numColumns;
+
+    for (int row = 0; row < BOX_WALL_ROW_NUM; ++row)
+    {
+        uint8_t& health = GetHealth(m_newestColumn, row);
+
+        if (health != 0) --m_numBoxes;
+
+        health = 0;
+    }
+
+    int const boxNumUp   = g_rng->RollRandomIntInRange(1, BOX_WALL_STACK_HEIGHT);
+    int const boxNumDown = g_rng->RollRandomIntInRange(1, BOX_WALL_STACK_HEIGHT);
+
+    for (int stackIndex = 0; stackIndex < boxNumDown; ++stackIndex)
+    {
+        GetHealth(m_newestColumn, stackIndex) = BOX_HEALTH;
+    }
+
+    for (int stackIndex = 0; stackIndex < boxNumUp; ++stackIndex)
+    {
+        GetHealth(m_newestColumn, BOX_WALL_STACK_HEIGHT + stackIndex) = BOX_HEALTH;
+    }
+
+    m_numBoxes += boxNumUp + boxNumDown;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool BoxWall::TryGetFirstCellAlongSegment(Vec2 const& start, Vec2 const& displacement, sBoxWallCell& out_cell, float& out_hitFraction) const
+{
+    bool isHit = false;
+
+    ForEachBoxAlongSweep(start, displacement, 0.f, [&](sBoxWallCell const& cell, float const hitFraction)
+    {
+        if (isHit && hitFraction >= out_hitFraction) return;
+
+        out_cell        = cell;
+        out_hitFraction = hitFraction;
+        isHit           = true;
+    });
+
+    return isHit;
+}
+
+//----------------------------------------------------------------------------------------------------
+AABB2 BoxWall::GetCellBounds(sBoxWallCell const& cell) const
+{
+    Vec2 const bottomLeft = Vec2(GetColumnLeftX(GetColumnAge(cell.m_column)), m_rowBottoms[cell.m_row]);
+
+    return AABB2(bottomLeft, bottomLeft + Vec2(BOX_SIDE_LENGTH, BOX_SIDE_LENGTH));
+}
+
+//----------------------------------------------------------------------------------------------------
+bool BoxWall::DamageCell(sBoxWallCell const& cell)
+{
+    uint8_t& health = GetHealth(cell.m_column, cell.m_row);
+
+    if (health == 0) return false;
+
+    --health;
+
+    if (health > 0) return false;
+
+    --m_numBoxes;
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+size_t BoxWall::GetNumBytesReserved() const
+{
+    return m_cellHealth.capacity() * sizeof(uint8_t);
+}
@@ -0,0 +1,206 @@
+//----------------------------------------------------------------------------------------------------
+// BoxWall.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+//----------------------------------------------------------------------------------------------------
+#include "Game/CollisionKernels.hpp"
+#include "Game/GameCommon.hpp"
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Math/AABB2.hpp"
+#include "Engine/Renderer/Vertex_PCU.hpp"
+//----------------------------------------------------------------------------------------------------
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+//----------------------------------------------------------------------------------------------------
+class MeshLibrary;
+class RenderBatcher;
+
+//----------------------------------------------------------------------------------------------------
+struct sBoxWallCell
+{
+    int m_column = -1; // ring slot; stays the same while the column scrolls
+    int m_row    = -1; // [0, BOX_WALL_STACK_HEIGHT) is the bottom stack going up, the rest the top stack going down
+};
+
+//----------------------------------------------------------------------------------------------------
+// The scrolling wall of boxes, stored as a ring buffer of columns on one fixed lattice.
+// Every column is BOX_WALL_ROW_NUM cells of health, 0 meaning empty. Columns share a single scroll
+// offset, so moving the whole wall is one float update per frame, and a query only has to look at
+// the few columns under its x range instead of every box. A new column enters at the right edge every
+// BOX_WALL_STEP_SECONDS and reuses the slot of the oldest one, which has left the world by then.
+//
+class BoxWall
+{
+public:
+    BoxWall(MeshLibrary const* meshLibrary, RenderBatcher& batcher); // registers the box mesh for Render
+
+    void Update(float deltaSeconds);
+    void Render(RenderBatcher& batcher) const;
+    void DebugRender(RenderBatcher& batcher) const;
+    void Clear();
+    void PushColumn(); // random-height top and bottom stacks just past the right edge of the world
+
+    // First box a point moving from 'start' by 'displacement' runs into, with its hit fraction as
+    // SweepPointAgainstAABB gives it; only the columns and rows under the segment's bounds are tested
+    bool TryGetFirstCellAlongSegment(Vec2 const& start, Vec2 const& displacement, sBoxWallCell& out_cell, float& out_hitFraction) const;
+
+    // 'func' is called as func(sBoxWallCell const&, float hitFraction) for every box a disc of 'radius'
+    // moving from 'start' by 'displacement' touches, in column then row order, with the fraction
+    // SweepDiscAgainstAABB gives; only the columns and rows under the sweep's bounds are tested
+    template <typename Func>
+    void ForEachBoxAlongSweep(Vec2 const& start, Vec2 const& displacement, float radius, Func&& func) const;
+
+    // 'func' is called as func(sBoxWallCell const&) for every box whose inscribed disc overlaps the
+    // given one, each column tested in one kernel batch. The whole query uses 'center' as passed, so a
+    // caller that moves the querier from inside 'func' must re-check each later box itself.
+    template <typename Func>
+    void ForEachBoxOverlappingDisc(Vec2 center, float radius, Func&& func) const;
+
+    // 'func' is called as func(sBoxWallCell const&) for every box whose cell overlaps the bounds, in
+    // column then row order; only the columns and rows under the bounds are visited
+    template <typename Func>
+    void ForEachBoxOverlappingBounds(AABB2 const& bounds, Func&& func) const;
+
+    template <typename Func>
+    void ForEachBox(Func&& func) const;
+
+    AABB2 GetCellBounds(sBoxWallCell const& cell) const;
+    bool  HasBox(sBoxWallCell const& cell) const { return GetHealth(cell.m_column, cell.m_row) != 0; }
+    bool  DamageCell(sBoxWallCell const& cell); // returns whether the box was destroyed
+
+    int    GetNumBoxes() const { return m_numBoxes; }
+    int    GetNumColumns() const { return m_numColumns; }
+    size_t GetNumBytesReserved() const;
+
+private:
+    int   GetColumnAge(int column) const { return (m_newestColumn - column + m_numColumns) % m_numColumns; }
+    int   GetColumnSlot(int age) const { return (m_newestColumn - age + m_numColumns) % m_numColumns; }
+    float GetColumnLeftX(int age) const { return WORLD_SIZE_X - m_scrollOffset - static_cast<float>(age) * BOX_WALL_PITCH; }
+
+    uint8_t& GetHealth(int column, int row) { return m_cellHealth[column * BOX_WALL_ROW_NUM + row]; }
+    uint8_t  GetHealth(int column, int row) const { return m_cellHealth[column * BOX_WALL_ROW_NUM + row]; }
+
+    int m_boxMeshIndex = 0; // with the RenderBatcher given on construction
+
+    int   m_numColumns     = 0;  // enough that the slot being reused has always scrolled out of the world
+    int   m_numLiveColumns = 0;
+    int   m_newestColumn   = 0;
+    int   m_numBoxes       = 0;
+    float m_scrollOffset   = 0.f; // how far the newest column has moved left since it entered, up to BOX_WALL_PITCH
+    float m_stepTime       = 0.f;
+
+    float                m_rowBottoms[BOX_WALL_ROW_NUM] = {};
+    float                m_rowCentersY[BOX_WALL_ROW_NUM] = {};
+    float                m_boxRadii[BOX_WALL_ROW_NUM]    = {}; // all BOX_SIDE_LENGTH / 2, packed for the kernel
+    std::vector<uint8_t> m_cellHealth; // column-major, BOX_WALL_ROW_NUM cells per column
+};
+
+//----------------------------------------------------------------------------------------------------
+template <typename Func>
+void BoxWall::ForEachBoxOverlappingDisc(Vec2 const center, float const radius, Func&& func) const
+{
+    static_assert(BOX_WALL_ROW_NUM <= 32, "A column's hit mask is one word");
+
+    // Column 'age' is centered on newestCenterX - age * pitch; only those within reach can overlap
+    float const newestCenterX = GetColumnLeftX(0) + BOX_SIDE_LENGTH / 2.f;
+    float const reach         = radius + BOX_SIDE_LENGTH / 2.f;
+    int         minAge        = static_cast<int>(std::ceil((newestCenterX - center.x - reach) / BOX_WALL_PITCH));
+    int         maxAge        = static_cast<int>(std::floor((newestCenterX - center.x + reach) / BOX_WALL_PITCH));
+
+    if (minAge < 0) minAge = 0;
+    if (maxAge > m_numLiveColumns - 1) maxAge = m_numLiveColumns - 1;
+
+    for (int age = minAge; age <= maxAge; ++age)
+    {
+        int const   column        = GetColumnSlot(age);
+        float const columnCenterX = GetColumnLeftX(age) + BOX_SIDE_LENGTH / 2.f;
+        float       centersX[BOX_WALL_ROW_NUM];
+        uint32_t    occupiedMask  = 0;
+
+        std::fill(centersX, centersX + BOX_WALL_ROW_NUM, columnCenterX); // the kernel takes one x per disc
+
+        for (int row = 0; row < BOX_WALL_ROW_NUM; ++row)
+        {
+            if (GetHealth(column, row) != 0) occupiedMask |= 1u << row;
+        }
+
+        if (occupiedMask == 0) continue;
+
+        uint32_t hitMask = 0;
+
+        FindDiscsOverlappingDisc(center, radius, centersX, m_rowCentersY, m_boxRadii, BOX_WALL_ROW_NUM, &hitMask);
+
+        hitMask &= occupiedMask;
+
+        while (hitMask != 0)
+        {
+            func(sBoxWallCell{column, std::countr_zero(hitMask)});
+            hitMask &= hitMask - 1;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename Func>
+void BoxWall::ForEachBoxAlongSweep(Vec2 const& start, Vec2 const& displacement, float const radius, Func&& func) const
+{
+    Vec2 const end  = start + displacement;
+    Vec2 const mins = Vec2(std::min(start.x, end.x) - radius, std::min(start.y, end.y) - radius);
+    Vec2 const maxs = Vec2(std::max(start.x, end.x) + radius, std::max(start.y, end.y) + radius);
+
+    ForEachBoxOverlappingBounds(AABB2(mins, maxs), [&](sBoxWallCell const& cell)
+    {
+        float hitFraction;
+
+        if (SweepDiscAgainstAABB(start, displacement, radius, GetCellBounds(cell), hitFraction)) func(cell, hitFraction);
+    });
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename Func>
+void BoxWall::ForEachBoxOverlappingBounds(AABB2 const& bounds, Func&& func) const
+{
+    Vec2 const mins = bounds.m_mins;
+    Vec2 const maxs = bounds.m_maxs;
+
+    // Column 'age' spans [leftX(age), leftX(age) + side]; keep those that reach into [mins.x, maxs.x].
+    // Clamped as floats, since unbounded bounds would not fit in an int.
+    float const newestLeftX = GetColumnLeftX(0);
+    float const lastAge     = static_cast<float>(m_numLiveColumns - 1);
+    int const   minAge      = static_cast<int>(std::clamp(std::ceil((newestLeftX - maxs.x) / BOX_WALL_PITCH), 0.f, lastAge + 1.f));
+    int const   maxAge      = static_cast<int>(std::clamp(std::floor((newestLeftX + BOX_SIDE_LENGTH - mins.x) / BOX_WALL_PITCH), -1.f, lastAge));
+
+    for (int age = minAge; age <= maxAge; ++age)
+    {
+        int const column = GetColumnSlot(age);
+
+        for (int row = 0; row < BOX_WALL_ROW_NUM; ++row)
+        {
+            if (GetHealth(column, row) == 0) continue;
+            if (m_rowBottoms[row] > maxs.y || m_rowBottoms[row] + BOX_SIDE_LENGTH < mins.y) continue;
+
+            func(sBoxWallCell{column, row});
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename Func>
+void BoxWall::ForEachBox(Func&& func) const
+{
+    for (int age = 0; age < m_numLiveColumns; ++age)
+    {
+        int const column = GetColumnSlot(age);
+
+        for (int row = 0; row < BOX_WALL_ROW_NUM; ++row)
+        {
+            if (GetHealth(column, row) != 0) func(sBoxWallCell{column, row});
+        }
+    }
+}
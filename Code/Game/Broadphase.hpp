@@ -0,0 +1,70 @@
+//----------------------------------------------------------------------------------------------------
+// Broadphase.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+//----------------------------------------------------------------------------------------------------
+#include "Game/EcsComponents.hpp"
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Math/Vec2.hpp"
+//----------------------------------------------------------------------------------------------------
+#include <cstdint>
+
+//----------------------------------------------------------------------------------------------------
+// What every broadphase stores per collider. CollisionGrid and SweepAndPrune share the same
+// Clear / Insert / Build / ForEachCandidate / ForEachOverlap / FindNearest shape, so Game picks one
+// at runtime and the narrowphase code around the queries stays the same.
+//
+struct sBroadphaseEntry
+{
+    Vec2         m_center;
+    float        m_radius = 0.f;                // physics radius
+    EntityHandle m_handle;
+    eEntityKind  m_kind   = eEntityKind::NUM;
+};
+
+//----------------------------------------------------------------------------------------------------
+// One result of a nearest-neighbor or radius query, measured between centers.
+//
+struct sBroadphaseNeighbor
+{
+    Vec2         m_center;
+    float        m_distance = 0.f;
+    EntityHandle m_handle;
+    eEntityKind  m_kind     = eEntityKind::NUM;
+};
+
+//----------------------------------------------------------------------------------------------------
+// Keeps out_neighbors[0, numNeighbors) sorted nearest first and at most maxNeighbors long, so a
+// query can collect its k best into the caller's buffer as it goes. Returns the new count; ties keep
+// whichever was found first.
+//
+inline int InsertNearestNeighbor(sBroadphaseNeighbor* out_neighbors, int numNeighbors, int const maxNeighbors, sBroadphaseNeighbor const& neighbor)
+{
+    if (numNeighbors == maxNeighbors && (maxNeighbors == 0 || neighbor.m_distance >= out_neighbors[numNeighbors - 1].m_distance)) return numNeighbors;
+
+    int index = numNeighbors < maxNeighbors ? numNeighbors++ : numNeighbors - 1;
+
+    while (index > 0 && out_neighbors[index - 1].m_distance > neighbor.m_distance)
+    {
+        out_neighbors[index] = out_neighbors[index - 1];
+        --index;
+    }
+
+    out_neighbors[index] = neighbor;
+
+    return numNeighbors;
+}
+
+//----------------------------------------------------------------------------------------------------
+enum class eBroadphase : uint8_t
+{
+    GRID,            // uniform hash grid; cost follows local density
+    SWEEP_AND_PRUNE, // intervals kept sorted on x; cost follows how many share the query's x range
+    NUM
+};
+
+constexpr char const* BROADPHASE_NAMES[] = {"grid", "sap"};
+
+static_assert(sizeof(BROADPHASE_NAMES) / sizeof(BROADPHASE_NAMES[0]) == static_cast<size_t>(eBroadphase::NUM), "One name per broadphase");
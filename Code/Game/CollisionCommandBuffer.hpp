@@ -0,0 +1,57 @@
+//----------------------------------------------------------------------------------------------------
+// CollisionCommandBuffer.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+//----------------------------------------------------------------------------------------------------
+#include "Game/EntityHandle.hpp"
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Math/Vec2.hpp"
+//----------------------------------------------------------------------------------------------------
+#include <cstdint>
+#include <vector>
+
+//----------------------------------------------------------------------------------------------------
+enum class eCollisionHitKind : uint8_t
+{
+    PLAYER_SHIP_VS_ENEMY,
+    PLAYER_SHIP_VS_BOX,
+    BULLET_VS_ENEMY,
+    BULLET_VS_BOX
+};
+
+//----------------------------------------------------------------------------------------------------
+// One contact found by collision detection, with no side effects applied yet.
+//
+struct sCollisionHit
+{
+    Vec2              m_position;      // contact point for bullets, the ship's position for the ship
+    EntityHandle      m_source;        // the player ship or the bullet
+    EntityHandle      m_target;        // the enemy; invalid for box hits
+    uint16_t          m_boxColumn = 0; // sBoxWallCell of a box hit
+    uint8_t           m_boxRow    = 0;
+    eCollisionHitKind m_kind      = eCollisionHitKind::BULLET_VS_ENEMY;
+};
+
+static_assert(sizeof(sCollisionHit) == 20, "sCollisionHit is meant to stay compact");
+
+//----------------------------------------------------------------------------------------------------
+// Hits recorded by one detection task, in the order it found them.
+// Detection only reads the world and appends here. Game applies every buffer in task order at one
+// sync point, so damage, debris, sounds, score and spawns happen in a fixed order no matter which
+// thread ran which task.
+//
+class CollisionCommandBuffer
+{
+public:
+    void Reserve(int maxHits) { m_hits.reserve(maxHits); }
+    void Clear() { m_hits.clear(); }
+    void Push(sCollisionHit const& hit) { m_hits.push_back(hit); }
+
+    std::vector<sCollisionHit> const& GetHits() const { return m_hits; }
+    size_t                            GetNumBytesReserved() const { return m_hits.capacity() * sizeof(sCollisionHit); }
+
+private:
+    std::vector<sCollisionHit> m_hits;
+};
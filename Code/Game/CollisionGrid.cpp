@@ -0,0 +1,106 @@
+//----------------------------------------------------------------------------------------------------
+// CollisionGrid.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/CollisionGrid.hpp"
+//----------------------------------------------------------------------------------------------------
+#include <algorithm>
+
+//----------------------------------------------------------------------------------------------------
+CollisionGrid::CollisionGrid(Vec2 const& worldSize, float const cellSize, int const maxEntries)
+    : m_cellSize(cellSize),
+      m_numCellsX(std::max(1, static_cast<int>(std::ceil(worldSize.x / cellSize)))),
+      m_numCellsY(std::max(1, static_cast<int>(std::ceil(worldSize.y / cellSize))))
+{
+    int const numCells = m_numCellsX * m_numCellsY;
+
+    m_entries.reserve(maxEntries);
+    m_entryCells.reserve(maxEntries);
+    m_sortedEntries.resize(maxEntries);
+    m_sortedCentersX.resize(maxEntries);
+    m_sortedCentersY.resize(maxEntries);
+    m_sortedRadii.resize(maxEntries);
+    m_cellStarts.assign(numCells + 1, 0);
+    m_cellCursors.resize(numCells);
+}
+
+//----------------------------------------------------------------------------------------------------
+void CollisionGrid::Clear()
+{
+    m_entries.clear();
+    m_entryCells.clear();
+    std::fill(m_cellStarts.begin(), m_cellStarts.end(), 0);
+
+    m_maxEntryRadius = 0.f;
+    m_numCandidatesVisited.store(0, std::memory_order_relaxed);
+}
+
+//----------------------------------------------------------------------------------------------------
+void CollisionGrid::Insert(sBroadphaseEntry const& entry)
+{
+    m_entries.push_back(entry);
+    m_entryCells.push_back(GetWrappedCellIndex(GetCellCoord(entry.m_center.x), GetCellCoord(entry.m_center.y)));
+
+    if (entry.m_radius > m_maxEntryRadius) m_maxEntryRadius = entry.m_radius;
+}
+
+//----------------------------------------------------------------------------------------------------
+void CollisionGrid::Build()
+{
+    int const numCells   = m_numCellsX * m_numCellsY;
+    int const numEntries = static_cast<int>(m_entries.size());
+
+    if (static_cast<int>(m_sortedEntries.size()) < numEntries)
+    {
+        m_sortedEntries.resize(numEntries);
+        m_sortedCentersX.resize(numEntries);
+        m_sortedCentersY.resize(numEntries);
+        m_sortedRadii.resize(numEntries);
+    }
+
+    // Count per cell into m_cellStarts[c + 1], then prefix-sum into start offsets
+    std::fill(m_cellStarts.begin(), m_cellStarts.end(), 0);
+
+    for (int const cellIndex : m_entryCells)
+    {
+        ++m_cellStarts[cellIndex + 1];
+    }
+
+    for (int cellIndex = 0; cellIndex < numCells; ++cellIndex)
+    {
+        m_cellStarts[cellIndex + 1] += m_cellStarts[cellIndex];
+        m_cellCursors[cellIndex]    =  m_cellStarts[cellIndex];
+    }
+
+    for (int entryIndex = 0; entryIndex < numEntries; ++entryIndex)
+    {
+        sBroadphaseEntry const& entry       = m_entries[entryIndex];
+        int const               sortedIndex = m_cellCursors[m_entryCells[entryIndex]]++;
+
+        m_sortedEntries[sortedIndex]  = entry;
+        m_sortedCentersX[sortedIndex] = entry.m_center.x;
+        m_sortedCentersY[sortedIndex] = entry.m_center.y;
+        m_sortedRadii[sortedIndex]    = entry.m_radius;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+size_t CollisionGrid::GetNumBytesReserved() const
+{
+    return m_entries.capacity() * sizeof(sBroadphaseEntry) +
+           m_entryCells.capacity() * sizeof(int) +
+           m_sortedEntries.capacity() * sizeof(sBroadphaseEntry) +
+           (m_sortedCentersX.capacity() + m_sortedCentersY.capacity() + m_sortedRadii.capacity()) * sizeof(float) +
+           m_cellStarts.capacity() * sizeof(int) +
+           m_cellCursors.capacity() * sizeof(int);
+}
+
+//----------------------------------------------------------------------------------------------------
+int CollisionGrid::GetWrappedCellIndex(int const cellX, int const cellY) const
+{
+    int const wrappedX = (cellX % m_numCellsX + m_numCellsX) % m_numCellsX;
+    int const wrappedY = (cellY % m_numCellsY + m_numCellsY) % m_numCellsY;
+
+    return wrappedY * m_numCellsX + wrappedX;
+}
@@ -0,0 +1,367 @@
+//----------------------------------------------------------------------------------------------------
+// CollisionGrid.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+//----------------------------------------------------------------------------------------------------
+#include "Game/Broadphase.hpp"
+#include "Game/CollisionKernels.hpp"
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Math/Vec2.hpp"
+//----------------------------------------------------------------------------------------------------
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <vector>
+
+//----------------------------------------------------------------------------------------------------
+// Uniform-grid broadphase over the world.
+// Entries are bucketed by the cell holding their center and stored contiguously per cell, rebuilt
+// from scratch every frame with a counting sort. Cell coordinates wrap around the world like
+// TAG_WRAP_AROUND positions do, so entities that have drifted past an edge are still found, at worst
+// as a false candidate that the narrowphase rejects.
+//
+// Each entry lives in exactly one cell, and a query widens its search by the largest inserted radius,
+// so every overlapping entry is visited exactly once per query.
+//
+class CollisionGrid
+{
+public:
+    CollisionGrid(Vec2 const& worldSize, float cellSize, int maxEntries);
+
+    void Clear();
+    void Insert(sBroadphaseEntry const& entry);
+    void Build(); // buckets everything inserted since Clear(); call once before querying
+
+    // 'func' is called as func(sBroadphaseEntry const&) for every entry that may overlap the disc
+    template <typename Func>
+    void ForEachCandidate(Vec2 const& center, float radius, Func&& func) const;
+
+    // Same, narrowed to entries that do overlap it by the batched disc kernel, in the same order
+    template <typename Func>
+    void ForEachOverlap(Vec2 const& center, float radius, Func&& func) const;
+
+    // 'func' is called as func(sBroadphaseEntry const&) for every entry that may touch a disc swept
+    // from 'start' by 'displacement'; only the cells along the segment are visited, not its bounds
+    template <typename Func>
+    void ForEachCandidateAlongSegment(Vec2 const& start, Vec2 const& displacement, float radius, Func&& func) const;
+
+    // Writes the up to maxNeighbors entries whose centers are nearest 'center' and within maxDistance
+    // to out_neighbors, nearest first, and returns how many. Only entries for which filter(entry) is
+    // true count; it is asked after the distance test, so it only sees entries that could make the cut.
+    template <typename Filter>
+    int FindNearest(Vec2 const& center, float maxDistance, int maxNeighbors, sBroadphaseNeighbor* out_neighbors, Filter&& filter) const;
+
+    int    GetNumCellsX() const { return m_numCellsX; }
+    int    GetNumCellsY() const { return m_numCellsY; }
+    int    GetNumEntries() const { return static_cast<int>(m_entries.size()); }
+    int    GetNumCandidatesVisited() const { return m_numCandidatesVisited.load(std::memory_order_relaxed); } // since the last Clear()
+    size_t GetNumBytesReserved() const;
+
+private:
+    int GetCellCoord(float worldCoord) const { return static_cast<int>(std::floor(worldCoord / m_cellSize)); }
+    int GetWrappedCellIndex(int cellX, int cellY) const;
+
+    // 'func' is called as func(int firstEntry, int endEntry) for every cell the disc's reach touches
+    template <typename Func>
+    void ForEachCellInReach(Vec2 const& center, float radius, Func&& func) const;
+
+    // Same for the swept disc, one column of cells at a time
+    template <typename Func>
+    void ForEachCellAlongSegment(Vec2 const& start, Vec2 const& displacement, float radius, Func&& func) const;
+
+    // Offers every entry of one cell to FindNearest's buffer; returns the new neighbor count
+    template <typename Filter>
+    int GatherNearestInCell(int cellX, int cellY, Vec2 const& center, float maxDistance, int numNeighbors, int maxNeighbors,
+                            sBroadphaseNeighbor* out_neighbors, Filter& filter, int& out_numCandidates) const;
+
+    // Visits cells [minY, maxY] of column 'cellX'; returns how many entries they held
+    template <typename Func>
+    int ForEachCellInColumn(int cellX, int minY, int maxY, Func& func) const;
+
+    float m_cellSize       = 1.f;
+    int   m_numCellsX      = 1;
+    int   m_numCellsY      = 1;
+    float m_maxEntryRadius = 0.f;
+
+    std::vector<sBroadphaseEntry> m_entries;        // insertion order
+    std::vector<int>              m_entryCells;     // cell of each entry in m_entries
+    std::vector<sBroadphaseEntry> m_sortedEntries;  // grouped by cell
+    std::vector<float>            m_sortedCentersX; // m_sortedEntries' shapes, packed for the kernels
+    std::vector<float>            m_sortedCentersY;
+    std::vector<float>            m_sortedRadii;
+    std::vector<int>              m_cellStarts;     // cell c owns m_sortedEntries[m_cellStarts[c], m_cellStarts[c + 1])
+    std::vector<int>              m_cellCursors;    // scatter positions while building
+
+    mutable std::atomic<int> m_numCandidatesVisited = 0; // queries may run on several threads at once
+};
+
+//----------------------------------------------------------------------------------------------------
+template <typename Func>
+void CollisionGrid::ForEachCandidate(Vec2 const& center, float const radius, Func&& func) const
+{
+    ForEachCellInReach(center, radius, [this, &func](int const firstEntry, int const endEntry)
+    {
+        for (int entryIndex = firstEntry; entryIndex < endEntry; ++entryIndex)
+        {
+            func(m_sortedEntries[entryIndex]);
+        }
+    });
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename Func>
+void CollisionGrid::ForEachOverlap(Vec2 const& center, float const radius, Func&& func) const
+{
+    ForEachCellInReach(center, radius, [this, &center, radius, &func](int const firstEntry, int const endEntry)
+    {
+        ForEachDiscOverlappingDisc(center, radius,
+                                   m_sortedCentersX.data() + firstEntry,
+                                   m_sortedCentersY.data() + firstEntry,
+                                   m_sortedRadii.data() + firstEntry,
+                                   endEntry - firstEntry,
+                                   [this, firstEntry, &func](int const index)
+        {
+            func(m_sortedEntries[firstEntry + index]);
+        });
+    });
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename Func>
+void CollisionGrid::ForEachCandidateAlongSegment(Vec2 const& start, Vec2 const& displacement, float const radius, Func&& func) const
+{
+    ForEachCellAlongSegment(start, displacement, radius, [this, &func](int const firstEntry, int const endEntry)
+    {
+        for (int entryIndex = firstEntry; entryIndex < endEntry; ++entryIndex)
+        {
+            func(m_sortedEntries[entryIndex]);
+        }
+    });
+}
+
+//----------------------------------------------------------------------------------------------------
+// Visits rings of cells around the center's cell, nearest ring first. Ring r is at least r - 1 cells
+// plus the center's distance to its own cell's edge away, so the search stops once that is past
+// maxDistance, or past the farthest neighbor kept when the buffer is full. Rings are clipped to one
+// world's worth of cells around the center so that no wrapped cell is visited twice.
+//
+template <typename Filter>
+int CollisionGrid::FindNearest(Vec2 const& center, float const maxDistance, int const maxNeighbors, sBroadphaseNeighbor* out_neighbors, Filter&& filter) const
+{
+    if (maxNeighbors <= 0) return 0;
+
+    int const   centerX    = GetCellCoord(center.x);
+    int const   centerY    = GetCellCoord(center.y);
+    int const   minX       = centerX - (m_numCellsX - 1) / 2;
+    int const   maxX       = centerX + m_numCellsX / 2;
+    int const   minY       = centerY - (m_numCellsY - 1) / 2;
+    int const   maxY       = centerY + m_numCellsY / 2;
+    int const   maxRing    = std::max(std::max(centerX - minX, maxX - centerX), std::max(centerY - minY, maxY - centerY));
+    float const cellMinX   = static_cast<float>(centerX) * m_cellSize;
+    float const cellMinY   = static_cast<float>(centerY) * m_cellSize;
+    float const edgeMargin = std::min(std::min(center.x - cellMinX, cellMinX + m_cellSize - center.x),
+                                      std::min(center.y - cellMinY, cellMinY + m_cellSize - center.y));
+
+    int numNeighbors  = 0;
+    int numCandidates = 0;
+
+    for (int ring = 0; ring <= maxRing; ++ring)
+    {
+        float const ringDistance = ring == 0 ? 0.f : static_cast<float>(ring - 1) * m_cellSize + edgeMargin;
+
+        if (ringDistance > maxDistance) break;
+        if (numNeighbors == maxNeighbors && ringDistance >= out_neighbors[numNeighbors - 1].m_distance) break;
+
+        int const ringMinX = std::max(centerX - ring, minX);
+        int const ringMaxX = std::min(centerX + ring, maxX);
+        int const ringMinY = std::max(centerY - ring, minY);
+        int const ringMaxY = std::min(centerY + ring, maxY);
+
+        for (int cellY = ringMinY; cellY <= ringMaxY; ++cellY)
+        {
+            if (cellY == centerY - ring || cellY == centerY + ring)
+            {
+                for (int cellX = ringMinX; cellX <= ringMaxX; ++cellX)
+                {
+                    numNeighbors = GatherNearestInCell(cellX, cellY, center, maxDistance, numNeighbors, maxNeighbors, out_neighbors, filter, numCandidates);
+                }
+
+                continue;
+            }
+
+            // Rows in between only have the ring's two end cells; the rest belong to smaller rings
+            if (centerX - ring >= minX)
+            {
+                numNeighbors = GatherNearestInCell(centerX - ring, cellY, center, maxDistance, numNeighbors, maxNeighbors, out_neighbors, filter, numCandidates);
+            }
+
+            if (centerX + ring <= maxX)
+            {
+                numNeighbors = GatherNearestInCell(centerX + ring, cellY, center, maxDistance, numNeighbors, maxNeighbors, out_neighbors, filter, numCandidates);
+            }
+        }
+    }
+
+    m_numCandidatesVisited.fetch_add(numCandidates, std::memory_order_relaxed);
+
+    return numNeighbors;
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename Filter>
+int CollisionGrid::GatherNearestInCell(int const cellX, int const cellY, Vec2 const& center, float const maxDistance, int numNeighbors, int const maxNeighbors,
+                                       sBroadphaseNeighbor* out_neighbors, Filter& filter, int& out_numCandidates) const
+{
+    int const cellIndex  = GetWrappedCellIndex(cellX, cellY);
+    int const firstEntry = m_cellStarts[cellIndex];
+    int const endEntry   = m_cellStarts[cellIndex + 1];
+
+    out_numCandidates += endEntry - firstEntry;
+
+    for (int entryIndex = firstEntry; entryIndex < endEntry; ++entryIndex)
+    {
+        float const offsetX  = m_sortedCentersX[entryIndex] - center.x;
+        float const offsetY  = m_sortedCentersY[entryIndex] - center.y;
+        float const distance = std::sqrt(offsetX * offsetX + offsetY * offsetY);
+
+        if (distance > maxDistance) continue;
+        if (numNeighbors == maxNeighbors && distance >= out_neighbors[numNeighbors - 1].m_distance) continue;
+
+        sBroadphaseEntry const& entry = m_sortedEntries[entryIndex];
+
+        if (!filter(entry)) continue;
+
+        numNeighbors = InsertNearestNeighbor(out_neighbors, numNeighbors, maxNeighbors, {entry.m_center, distance, entry.m_handle, entry.m_kind});
+    }
+
+    return numNeighbors;
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename Func>
+void CollisionGrid::ForEachCellInReach(Vec2 const& center, float const radius, Func&& func) const
+{
+    float const reach = radius + m_maxEntryRadius;
+    int         minX  = GetCellCoord(center.x - reach);
+    int         maxX  = GetCellCoord(center.x + reach);
+    int         minY  = GetCellCoord(center.y - reach);
+    int         maxY  = GetCellCoord(center.y + reach);
+
+    // A reach wider than the world would visit wrapped cells twice
+    if (maxX - minX >= m_numCellsX)
+    {
+        minX = 0;
+        maxX = m_numCellsX - 1;
+    }
+
+    if (maxY - minY >= m_numCellsY)
+    {
+        minY = 0;
+        maxY = m_numCellsY - 1;
+    }
+
+    int numCandidates = 0;
+
+    for (int cellY = minY; cellY <= maxY; ++cellY)
+    {
+        for (int cellX = minX; cellX <= maxX; ++cellX)
+        {
+            int const cellIndex  = GetWrappedCellIndex(cellX, cellY);
+            int const firstEntry = m_cellStarts[cellIndex];
+            int const endEntry   = m_cellStarts[cellIndex + 1];
+
+            if (firstEntry == endEntry) continue;
+
+            numCandidates += endEntry - firstEntry;
+            func(firstEntry, endEntry);
+        }
+    }
+
+    // One shared write per query rather than per cell
+    m_numCandidatesVisited.fetch_add(numCandidates, std::memory_order_relaxed);
+}
+
+//----------------------------------------------------------------------------------------------------
+// An entry within reach of the segment has its center within reach of the segment's nearest point,
+// so in its own column that point lies on the part of the segment clipped to the column widened by
+// the reach. Each column therefore only needs the y range of that clipped part, widened again.
+//
+template <typename Func>
+void CollisionGrid::ForEachCellAlongSegment(Vec2 const& start, Vec2 const& displacement, float const radius, Func&& func) const
+{
+    Vec2 const  end   = start + displacement;
+    float const reach = radius + m_maxEntryRadius;
+    int         minX  = GetCellCoord(std::min(start.x, end.x) - reach);
+    int         maxX  = GetCellCoord(std::max(start.x, end.x) + reach);
+    bool const  isFullWidth = maxX - minX >= m_numCellsX;
+
+    // A segment wider than the world would visit wrapped columns twice; take each once, whole height
+    if (isFullWidth)
+    {
+        minX = 0;
+        maxX = m_numCellsX - 1;
+    }
+
+    int numCandidates = 0;
+
+    for (int cellX = minX; cellX <= maxX; ++cellX)
+    {
+        float lowY  = std::min(start.y, end.y);
+        float highY = std::max(start.y, end.y);
+
+        if (!isFullWidth && displacement.x != 0.f)
+        {
+            float enterFraction = (static_cast<float>(cellX) * m_cellSize - reach - start.x) / displacement.x;
+            float exitFraction  = (static_cast<float>(cellX + 1) * m_cellSize + reach - start.x) / displacement.x;
+
+            if (enterFraction > exitFraction) std::swap(enterFraction, exitFraction);
+
+            enterFraction = std::max(enterFraction, 0.f);
+            exitFraction  = std::min(exitFraction, 1.f);
+
+            if (enterFraction > exitFraction) continue;
+
+            float const enterY = start.y + displacement.y * enterFraction;
+            float const exitY  = start.y + displacement.y * exitFraction;
+
+            lowY  = std::min(enterY, exitY);
+            highY = std::max(enterY, exitY);
+        }
+
+        int minY = GetCellCoord(lowY - reach);
+        int maxY = GetCellCoord(highY + reach);
+
+        if (maxY - minY >= m_numCellsY)
+        {
+            minY = 0;
+            maxY = m_numCellsY - 1;
+        }
+
+        numCandidates += ForEachCellInColumn(cellX, minY, maxY, func);
+    }
+
+    m_numCandidatesVisited.fetch_add(numCandidates, std::memory_order_relaxed);
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename Func>
+int CollisionGrid::ForEachCellInColumn(int const cellX, int const minY, int const maxY, Func& func) const
+{
+    int numCandidates = 0;
+
+    for (int cellY = minY; cellY <= maxY; ++cellY)
+    {
+        int const cellIndex  = GetWrappedCellIndex(cellX, cellY);
+        int const firstEntry = m_cellStarts[cellIndex];
+        int const endEntry   = m_cellStarts[cellIndex + 1];
+
+        if (firstEntry == endEntry) continue;
+
+        numCandidates += endEntry - firstEntry;
+        func(firstEntry, endEntry);
+    }
+
+    return numCandidates;
+}
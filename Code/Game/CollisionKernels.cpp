@@ -0,0 +1,388 @@
+//----------------------------------------------------------------------------------------------------
+// CollisionKernels.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/CollisionKernels.hpp"
+//----------------------------------------------------------------------------------------------------
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+//----------------------------------------------------------------------------------------------------
+// SSE2 is part of every x64 target (and the default for Win32 builds); AVX is opted into per function
+// so the rest of the game keeps running on CPUs without it.
+//
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define COLLISION_KERNELS_X86
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define COLLISION_KERNELS_TARGET_AVX
+#else
+#define COLLISION_KERNELS_TARGET_AVX __attribute__((target("avx")))
+#endif
+#endif
+
+//----------------------------------------------------------------------------------------------------
+static bool IsAvxSupportedByCpuAndOs()
+{
+#if defined(COLLISION_KERNELS_X86) && defined(_MSC_VER)
+    int cpuInfo[4] = {};
+    __cpuid(cpuInfo, 1);
+
+    bool const hasOsxsave = (cpuInfo[2] & (1 << 27)) != 0;
+    bool const hasAvx     = (cpuInfo[2] & (1 << 28)) != 0;
+
+    // The OS must also save the YMM registers across context switches
+    return hasOsxsave && hasAvx && (_xgetbv(0) & 0x6) == 0x6;
+#elif defined(COLLISION_KERNELS_X86)
+    return __builtin_cpu_supports("avx");
+#else
+    return false;
+#endif
+}
+
+static eCollisionKernelPath s_collisionKernelPath = GetBestSupportedCollisionKernelPath();
+
+//----------------------------------------------------------------------------------------------------
+// Scalar kernels; also the tails of the SIMD paths
+//
+static bool IsDiscOverlappingDisc(float const centerX, float const centerY, float const radius,
+                                  float const otherX, float const otherY, float const otherRadius)
+{
+    float const deltaX    = otherX - centerX;
+    float const deltaY    = otherY - centerY;
+    float const radiusSum = otherRadius + radius;
+
+    return deltaX * deltaX + deltaY * deltaY < radiusSum * radiusSum;
+}
+
+static bool IsPointInsideAABB(float const pointX, float const pointY,
+                              float const minX, float const minY, float const maxX, float const maxY)
+{
+    return pointX > minX && pointX < maxX && pointY > minY && pointY < maxY;
+}
+
+static void FindDiscsOverlappingDiscScalar(Vec2 const& center, float const radius,
+                                           float const* centersX, float const* centersY, float const* radii,
+                                           int const firstIndex, int const count, uint32_t* out_hitMasks)
+{
+    for (int index = firstIndex; index < count; ++index)
+    {
+        if (IsDiscOverlappingDisc(center.x, center.y, radius, centersX[index], centersY[index], radii[index]))
+        {
+            out_hitMasks[index >> 5] |= 1u << (index & 31);
+        }
+    }
+}
+
+static void FindAABBsContainingPointScalar(Vec2 const& point,
+                                           float const* minsX, float const* minsY, float const* maxsX, float const* maxsY,
+                                           int const firstIndex, int const count, uint32_t* out_hitMasks)
+{
+    for (int index = firstIndex; index < count; ++index)
+    {
+        if (IsPointInsideAABB(point.x, point.y, minsX[index], minsY[index], maxsX[index], maxsY[index]))
+        {
+            out_hitMasks[index >> 5] |= 1u << (index & 31);
+        }
+    }
+}
+
+#if defined(COLLISION_KERNELS_X86)
+//----------------------------------------------------------------------------------------------------
+// SSE2 kernels; lanes start on multiples of 4, so each movemask lands inside one mask word
+//
+static int FindDiscsOverlappingDiscSse2(Vec2 const& center, float const radius,
+                                        float const* centersX, float const* centersY, float const* radii,
+                                        int const count, uint32_t* out_hitMasks)
+{
+    __m128 const queryX      = _mm_set1_ps(center.x);
+    __m128 const queryY      = _mm_set1_ps(center.y);
+    __m128 const queryRadius = _mm_set1_ps(radius);
+
+    int index = 0;
+
+    for (; index + 4 <= count; index += 4)
+    {
+        __m128 const deltaX    = _mm_sub_ps(_mm_loadu_ps(centersX + index), queryX);
+        __m128 const deltaY    = _mm_sub_ps(_mm_loadu_ps(centersY + index), queryY);
+        __m128 const radiusSum = _mm_add_ps(_mm_loadu_ps(radii + index), queryRadius);
+        __m128 const distSq    = _mm_add_ps(_mm_mul_ps(deltaX, deltaX), _mm_mul_ps(deltaY, deltaY));
+        __m128 const hits      = _mm_cmplt_ps(distSq, _mm_mul_ps(radiusSum, radiusSum));
+
+        out_hitMasks[index >> 5] |= static_cast<uint32_t>(_mm_movemask_ps(hits)) << (index & 31);
+    }
+
+    return index;
+}
+
+static int FindAABBsContainingPointSse2(Vec2 const& point,
+                                        float const* minsX, float const* minsY, float const* maxsX, float const* maxsY,
+                                        int const count, uint32_t* out_hitMasks)
+{
+    __m128 const pointX = _mm_set1_ps(point.x);
+    __m128 const pointY = _mm_set1_ps(point.y);
+
+    int index = 0;
+
+    for (; index + 4 <= count; index += 4)
+    {
+        __m128 const insideX = _mm_and_ps(_mm_cmpgt_ps(pointX, _mm_loadu_ps(minsX + index)),
+                                          _mm_cmplt_ps(pointX, _mm_loadu_ps(maxsX + index)));
+        __m128 const insideY = _mm_and_ps(_mm_cmpgt_ps(pointY, _mm_loadu_ps(minsY + index)),
+                                          _mm_cmplt_ps(pointY, _mm_loadu_ps(maxsY + index)));
+
+        out_hitMasks[index >> 5] |= static_cast<uint32_t>(_mm_movemask_ps(_mm_and_ps(insideX, insideY))) << (index & 31);
+    }
+
+    return index;
+}
+
+//----------------------------------------------------------------------------------------------------
+// AVX kernels; ordered, non-signalling compares match the scalar operators, NaN included
+//
+COLLISION_KERNELS_TARGET_AVX
+static int FindDiscsOverlappingDiscAvx(Vec2 const& center, float const radius,
+                                       float const* centersX, float const* centersY, float const* radii,
+                                       int const count, uint32_t* out_hitMasks)
+{
+    __m256 const queryX      = _mm256_set1_ps(center.x);
+    __m256 const queryY      = _mm256_set1_ps(center.y);
+    __m256 const queryRadius = _mm256_set1_ps(radius);
+
+    int index = 0;
+
+    for (; index + 8 <= count; index += 8)
+    {
+        __m256 const deltaX    = _mm256_sub_ps(_mm256_loadu_ps(centersX + index), queryX);
+        __m256 const deltaY    = _mm256_sub_ps(_mm256_loadu_ps(centersY + index), queryY);
+        __m256 const radiusSum = _mm256_add_ps(_mm256_loadu_ps(radii + index), queryRadius);
+        __m256 const distSq    = _mm256_add_ps(_mm256_mul_ps(deltaX, deltaX), _mm256_mul_ps(deltaY, deltaY));
+        __m256 const hits      = _mm256_cmp_ps(distSq, _mm256_mul_ps(radiusSum, radiusSum), _CMP_LT_OQ);
+
+        out_hitMasks[index >> 5] |= static_cast<uint32_t>(_mm256_movemask_ps(hits)) << (index & 31);
+    }
+
+    return index;
+}
+
+COLLISION_KERNELS_TARGET_AVX
+static int FindAABBsContainingPointAvx(Vec2 const& point,
+                                       float const* minsX, float const* minsY, float const* maxsX, float const* maxsY,
+                                       int const count, uint32_t* out_hitMasks)
+{
+    __m256 const pointX = _mm256_set1_ps(point.x);
+    __m256 const pointY = _mm256_set1_ps(point.y);
+
+    int index = 0;
+
+    for (; index + 8 <= count; index += 8)
+    {
+        __m256 const insideX = _mm256_and_ps(_mm256_cmp_ps(pointX, _mm256_loadu_ps(minsX + index), _CMP_GT_OQ),
+                                             _mm256_cmp_ps(pointX, _mm256_loadu_ps(maxsX + index), _CMP_LT_OQ));
+        __m256 const insideY = _mm256_and_ps(_mm256_cmp_ps(pointY, _mm256_loadu_ps(minsY + index), _CMP_GT_OQ),
+                                             _mm256_cmp_ps(pointY, _mm256_loadu_ps(maxsY + index), _CMP_LT_OQ));
+
+        out_hitMasks[index >> 5] |= static_cast<uint32_t>(_mm256_movemask_ps(_mm256_and_ps(insideX, insideY))) << (index & 31);
+    }
+
+    return index;
+}
+#endif
+
+//----------------------------------------------------------------------------------------------------
+void FindDiscsOverlappingDisc(Vec2 const& center, float const radius,
+                              float const* centersX, float const* centersY, float const* radii,
+                              int const count, uint32_t* out_hitMasks)
+{
+    std::memset(out_hitMasks, 0, sizeof(uint32_t) * static_cast<size_t>(GetCollisionHitMaskWords(count)));
+
+    int firstScalarIndex = 0;
+
+#if defined(COLLISION_KERNELS_X86)
+    if (s_collisionKernelPath == eCollisionKernelPath::AVX)
+    {
+        firstScalarIndex = FindDiscsOverlappingDiscAvx(center, radius, centersX, centersY, radii, count, out_hitMasks);
+    }
+    else if (s_collisionKernelPath == eCollisionKernelPath::SSE2)
+    {
+        firstScalarIndex = FindDiscsOverlappingDiscSse2(center, radius, centersX, centersY, radii, count, out_hitMasks);
+    }
+#endif
+
+    FindDiscsOverlappingDiscScalar(center, radius, centersX, centersY, radii, firstScalarIndex, count, out_hitMasks);
+}
+
+//----------------------------------------------------------------------------------------------------
+void FindAABBsContainingPoint(Vec2 const& point,
+                              float const* minsX, float const* minsY, float const* maxsX, float const* maxsY,
+                              int const count, uint32_t* out_hitMasks)
+{
+    std::memset(out_hitMasks, 0, sizeof(uint32_t) * static_cast<size_t>(GetCollisionHitMaskWords(count)));
+
+    int firstScalarIndex = 0;
+
+#if defined(COLLISION_KERNELS_X86)
+    if (s_collisionKernelPath == eCollisionKernelPath::AVX)
+    {
+        firstScalarIndex = FindAABBsContainingPointAvx(point, minsX, minsY, maxsX, maxsY, count, out_hitMasks);
+    }
+    else if (s_collisionKernelPath == eCollisionKernelPath::SSE2)
+    {
+        firstScalarIndex = FindAABBsContainingPointSse2(point, minsX, minsY, maxsX, maxsY, count, out_hitMasks);
+    }
+#endif
+
+    FindAABBsContainingPointScalar(point, minsX, minsY, maxsX, maxsY, firstScalarIndex, count, out_hitMasks);
+}
+
+//----------------------------------------------------------------------------------------------------
+// Solves |start + t * displacement - otherCenter| = radius sum for the entering root.
+//
+bool SweepDiscAgainstDisc(Vec2 const& start, Vec2 const& displacement, float const radius,
+                          Vec2 const& otherCenter, float const otherRadius, float& out_hitFraction)
+{
+    Vec2 const  offset    = start - otherCenter;
+    float const radiusSum = radius + otherRadius;
+    float const c         = offset.x * offset.x + offset.y * offset.y - radiusSum * radiusSum;
+
+    if (c < 0.f)
+    {
+        out_hitFraction = 0.f;
+        return true;
+    }
+
+    float const a = displacement.x * displacement.x + displacement.y * displacement.y;
+    float const b = offset.x * displacement.x + offset.y * displacement.y;
+
+    // Not moving, or moving away
+    if (a <= 0.f || b >= 0.f) return false;
+
+    float const discriminant = b * b - a * c;
+
+    if (discriminant <= 0.f) return false;
+
+    float const hitFraction = (-b - std::sqrt(discriminant)) / a;
+
+    if (hitFraction > 1.f) return false;
+
+    out_hitFraction = hitFraction;
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Slab test: the point is inside while it is strictly between the planes of both axes.
+//
+bool SweepPointAgainstAABB(Vec2 const& start, Vec2 const& displacement, AABB2 const& bounds, float& out_hitFraction)
+{
+    float enterFraction = 0.f;
+    float exitFraction  = 1.f;
+
+    float const starts[2]        = {start.x, start.y};
+    float const displacements[2] = {displacement.x, displacement.y};
+    float const mins[2]          = {bounds.m_mins.x, bounds.m_mins.y};
+    float const maxs[2]          = {bounds.m_maxs.x, bounds.m_maxs.y};
+
+    for (int axis = 0; axis < 2; ++axis)
+    {
+        if (displacements[axis] == 0.f)
+        {
+            if (starts[axis] <= mins[axis] || starts[axis] >= maxs[axis]) return false;
+
+            continue;
+        }
+
+        float const inverse      = 1.f / displacements[axis];
+        float       nearFraction = (mins[axis] - starts[axis]) * inverse;
+        float       farFraction  = (maxs[axis] - starts[axis]) * inverse;
+
+        if (nearFraction > farFraction) std::swap(nearFraction, farFraction);
+
+        enterFraction = std::max(enterFraction, nearFraction);
+        exitFraction  = std::min(exitFraction, farFraction);
+
+        if (enterFraction >= exitFraction) return false;
+    }
+
+    out_hitFraction = enterFraction;
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+// The box grown by 'radius' on every side, with its corners rounded off. The point sweep against the
+// square-cornered version finds the contact unless it lands in a corner square; there the only part
+// of the rounded shape the path can reach first is that corner's disc, which decides on its own.
+//
+bool SweepDiscAgainstAABB(Vec2 const& start, Vec2 const& displacement, float const radius, AABB2 const& bounds, float& out_hitFraction)
+{
+    AABB2 const grown = AABB2(bounds.m_mins - Vec2(radius, radius), bounds.m_maxs + Vec2(radius, radius));
+    float       hitFraction;
+
+    if (!SweepPointAgainstAABB(start, displacement, grown, hitFraction)) return false;
+
+    Vec2 const contact        = start + displacement * hitFraction;
+    bool const isOutsideSlabX = contact.x < bounds.m_mins.x || contact.x > bounds.m_maxs.x;
+    bool const isOutsideSlabY = contact.y < bounds.m_mins.y || contact.y > bounds.m_maxs.y;
+
+    if (radius <= 0.f || !isOutsideSlabX || !isOutsideSlabY)
+    {
+        out_hitFraction = hitFraction;
+        return true;
+    }
+
+    Vec2 const corner = Vec2(contact.x < bounds.m_mins.x ? bounds.m_mins.x : bounds.m_maxs.x,
+                             contact.y < bounds.m_mins.y ? bounds.m_mins.y : bounds.m_maxs.y);
+
+    return SweepDiscAgainstDisc(start, displacement, radius, corner, 0.f, out_hitFraction);
+}
+
+//----------------------------------------------------------------------------------------------------
+eCollisionKernelPath GetCollisionKernelPath()
+{
+    return s_collisionKernelPath;
+}
+
+//----------------------------------------------------------------------------------------------------
+eCollisionKernelPath GetBestSupportedCollisionKernelPath()
+{
+    if (IsCollisionKernelPathSupported(eCollisionKernelPath::AVX)) return eCollisionKernelPath::AVX;
+    if (IsCollisionKernelPathSupported(eCollisionKernelPath::SSE2)) return eCollisionKernelPath::SSE2;
+
+    return eCollisionKernelPath::SCALAR;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool IsCollisionKernelPathSupported(eCollisionKernelPath const path)
+{
+    switch (path)
+    {
+    case eCollisionKernelPath::SCALAR: return true;
+#if defined(COLLISION_KERNELS_X86)
+    case eCollisionKernelPath::SSE2: return true;
+    case eCollisionKernelPath::AVX: return IsAvxSupportedByCpuAndOs();
+#endif
+    default: return false;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void SetCollisionKernelPath(eCollisionKernelPath const path)
+{
+    if (IsCollisionKernelPathSupported(path)) s_collisionKernelPath = path;
+}
+
+//----------------------------------------------------------------------------------------------------
+char const* GetCollisionKernelPathName(eCollisionKernelPath const path)
+{
+    switch (path)
+    {
+    case eCollisionKernelPath::SCALAR: return "scalar";
+    case eCollisionKernelPath::SSE2: return "SSE2";
+    case eCollisionKernelPath::AVX: return "AVX";
+    default: return "unknown";
+    }
+}
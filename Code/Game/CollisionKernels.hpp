@@ -0,0 +1,80 @@
+//----------------------------------------------------------------------------------------------------
+// CollisionKernels.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Math/AABB2.hpp"
+#include "Engine/Math/Vec2.hpp"
+//----------------------------------------------------------------------------------------------------
+#include <bit>
+#include <cstdint>
+
+//----------------------------------------------------------------------------------------------------
+// Narrowphase tests of one disc or point against packed (structure-of-arrays) shapes.
+// Results are hit masks: bit (i % 32) of out_hitMasks[i / 32] is set when shape i passes, and every
+// word the count touches is written. Every path does the same float operations in the same order
+// per lane, so SSE2 and AVX give bit-identical masks to the scalar path.
+//
+enum class eCollisionKernelPath : uint8_t
+{
+    SCALAR,
+    SSE2, // 4 lanes
+    AVX,  // 8 lanes; chosen at startup only when the CPU and OS support it
+    NUM
+};
+
+constexpr int GetCollisionHitMaskWords(int const count) { return (count + 31) / 32; }
+
+// Same rule as DoDiscsOverlap2D: squared center distance strictly below the squared radius sum
+void FindDiscsOverlappingDisc(Vec2 const& center, float radius,
+                              float const* centersX, float const* centersY, float const* radii,
+                              int count, uint32_t* out_hitMasks);
+
+// Same rule as AABB2::IsPointInside: strictly inside on both axes
+void FindAABBsContainingPoint(Vec2 const& point,
+                              float const* minsX, float const* minsY, float const* maxsX, float const* maxsY,
+                              int count, uint32_t* out_hitMasks);
+
+// 'func' is called as func(int index) for every disc FindDiscsOverlappingDisc reports, in index
+// order. One mask word per batch, so 'func' may run between batches without a scratch buffer.
+template <typename Func>
+void ForEachDiscOverlappingDisc(Vec2 const& center, float radius,
+                                float const* centersX, float const* centersY, float const* radii,
+                                int count, Func&& func);
+
+// Swept tests for fast movers that would otherwise step over thin targets in one frame. Each moves
+// from 'start' by 'displacement' and, on a hit, writes the fraction of the displacement at first
+// contact in [0, 1]; 0 if the mover already overlaps at 'start', using the same rules as above.
+bool SweepDiscAgainstDisc(Vec2 const& start, Vec2 const& displacement, float radius,
+                          Vec2 const& otherCenter, float otherRadius, float& out_hitFraction);
+bool SweepPointAgainstAABB(Vec2 const& start, Vec2 const& displacement, AABB2 const& bounds, float& out_hitFraction);
+bool SweepDiscAgainstAABB(Vec2 const& start, Vec2 const& displacement, float radius, AABB2 const& bounds, float& out_hitFraction);
+
+eCollisionKernelPath GetCollisionKernelPath();
+eCollisionKernelPath GetBestSupportedCollisionKernelPath();
+bool                 IsCollisionKernelPathSupported(eCollisionKernelPath path);
+void                 SetCollisionKernelPath(eCollisionKernelPath path); // ignored if unsupported
+char const*          GetCollisionKernelPathName(eCollisionKernelPath path);
+
+//----------------------------------------------------------------------------------------------------
+template <typename Func>
+void ForEachDiscOverlappingDisc(Vec2 const& center, float const radius,
+                                float const* centersX, float const* centersY, float const* radii,
+                                int const count, Func&& func)
+{
+    for (int batchStart = 0; batchStart < count; batchStart += 32)
+    {
+        int const batchSize = count - batchStart < 32 ? count - batchStart : 32;
+        uint32_t  hitMask   = 0;
+
+        FindDiscsOverlappingDisc(center, radius, centersX + batchStart, centersY + batchStart, radii + batchStart, batchSize, &hitMask);
+
+        while (hitMask != 0)
+        {
+            func(batchStart + std::countr_zero(hitMask));
+            hitMask &= hitMask - 1;
+        }
+    }
+}
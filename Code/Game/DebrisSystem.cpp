@@ -0,0 +1,274 @@
+//----------------------------------------------------------------------------------------------------
+// DebrisSystem.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/DebrisSystem.hpp"
+//----------------------------------------------------------------------------------------------------
+#include "Game/MeshLibrary.hpp"
+#include "Game/RenderBatcher.hpp"
+#include "Game/WorkerPool.hpp"
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Math/RandomNumberGenerator.hpp"
+//----------------------------------------------------------------------------------------------------
+#include <algorithm>
+
+//----------------------------------------------------------------------------------------------------
+DebrisSystem::DebrisSystem(int const capacity, MeshLibrary const* meshLibrary)
+    : m_meshLibrary(meshLibrary),
+      m_capacity(capacity)
+{
+    m_positions.resize(capacity);
+    m_velocities.resize(capacity);
+    m_orientationDegrees.resize(capacity);
+    m_angularVelocities.resize(capacity);
+    m_lifetimes.resize(capacity);
+    m_cosmeticRadii.resize(capacity);
+    m_colors.resize(capacity);
+    m_meshVariantIndices.resize(capacity);
+    m_visibleIndices.resize(capacity);
+}
+
+//----------------------------------------------------------------------------------------------------
+// Integrates, ages and culls every live particle in one linear pass.
+//
+void DebrisSystem::Update(float const deltaSeconds)
+{
+    int debrisIndex = 0;
+
+    while (debrisIndex < m_numLive)
+    {
+        m_positions[debrisIndex]          += m_velocities[debrisIndex] * deltaSeconds;
+        m_orientationDegrees[debrisIndex] += m_angularVelocities[debrisIndex] * deltaSeconds;
+        m_lifetimes[debrisIndex]          -= deltaSeconds;
+
+        if (m_lifetimes[debrisIndex] <= 0.f || IsOffScreen(debrisIndex))
+        {
+            // The last live particle now sits at debrisIndex, so don't advance
+            KillDebris(debrisIndex);
+            continue;
+        }
+
+        ++debrisIndex;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// Culling packs the visible particles' indices first, so the stream gets room for exactly those.
+// They are then transformed RENDER_SHAPES_PER_TASK per task, the n-th visible particle always writing
+// the n-th slot, so the verts are the same on any number of threads.
+//
+void DebrisSystem::Render(RenderBatcher& batcher, WorkerPool& workerPool)
+{
+    if (m_numLive == 0) return;
+
+    int numVisible = 0;
+
+    for (int debrisIndex = 0; debrisIndex < m_numLive; ++debrisIndex)
+    {
+        if (batcher.IsDiscVisible(m_positions[debrisIndex], m_cosmeticRadii[debrisIndex])) m_visibleIndices[numVisible++] = debrisIndex;
+    }
+
+    batcher.AddNumCulled(m_numLive - numVisible);
+
+    if (numVisible == 0) return;
+
+    Vertex_PCU* const worldVerts = batcher.Append(sRenderState(), numVisible * DEBRIS_VERTS_NUM);
+    int const         numTasks   = (numVisible + RENDER_SHAPES_PER_TASK - 1) / RENDER_SHAPES_PER_TASK;
+
+    workerPool.ParallelFor(numTasks, [this, worldVerts, numVisible](int const taskIndex)
+    {
+        int const firstVisible = taskIndex * RENDER_SHAPES_PER_TASK;
+        int const endVisible   = std::min(firstVisible + RENDER_SHAPES_PER_TASK, numVisible);
+
+        for (int visibleIndex = firstVisible; visibleIndex < endVisible; ++visibleIndex)
+        {
+            WriteDebrisVerts(m_visibleIndices[visibleIndex], worldVerts + visibleIndex * DEBRIS_VERTS_NUM);
+        }
+    });
+}
+
+//----------------------------------------------------------------------------------------------------
+void DebrisSystem::DebugRender(Vec2 const& playerShipPos, RenderBatcher& batcher) const
+{
+    for (int debrisIndex = 0; debrisIndex < m_numLive; ++debrisIndex)
+    {
+        Vec2 const  position       = m_positions[debrisIndex];
+        Vec2 const  fwdNormal      = Vec2::MakeFromPolarDegrees(m_orientationDegrees[debrisIndex]);
+        float const cosmeticRadius = m_cosmeticRadii[debrisIndex];
+
+        if (!batcher.IsDiscVisible(position, cosmeticRadius + m_velocities[debrisIndex].GetLength())) continue;
+
+        DebugDrawLine(batcher,
+                      playerShipPos,
+                      position,
+                      0.2f,
+                      DEBUG_RENDER_GREY);
+        DebugDrawLine(batcher,
+                      position,
+                      position + fwdNormal * cosmeticRadius,
+                      0.2f,
+                      DEBUG_RENDER_RED);
+        DebugDrawLine(batcher,
+                      position,
+                      position + fwdNormal.GetRotated90Degrees() * cosmeticRadius,
+                      0.2f,
+                      DEBUG_RENDER_GREEN);
+        DebugDrawRing(batcher,
+                      position,
+                      cosmeticRadius,
+                      0.2f,
+                      DEBUG_RENDER_MAGENTA);
+        DebugDrawLine(batcher,
+                      position,
+                      position + m_velocities[debrisIndex],
+                      0.2f,
+                      DEBUG_RENDER_YELLOW);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void DebrisSystem::Clear()
+{
+    m_numLive = 0;
+}
+
+//----------------------------------------------------------------------------------------------------
+void DebrisSystem::SpawnDebris(Vec2 const& position, Vec2 const& velocity, float const radius, Rgba8 const& color)
+{
+    if (m_numLive >= m_capacity) return;
+
+    int const debrisIndex = m_numLive;
+    ++m_numLive;
+
+    if (m_numLive > m_highWaterMark) m_highWaterMark = m_numLive;
+
+    float const cosmeticRadius = radius * 1.5f;
+
+    m_positions[debrisIndex]          = position;
+    m_velocities[debrisIndex]         = velocity;
+    m_orientationDegrees[debrisIndex] = g_rng->RollRandomFloatInRange(0.f, 360.f);
+    m_angularVelocities[debrisIndex]  = g_rng->RollRandomFloatInRange(-200.f, 200.f);
+    m_lifetimes[debrisIndex]          = DEBRIS_LIFETIME_SECONDS;
+    m_cosmeticRadii[debrisIndex]      = cosmeticRadius;
+    m_colors[debrisIndex]             = Rgba8(color.r, color.g, color.b, 127);
+    m_meshVariantIndices[debrisIndex] = static_cast<uint8_t>(g_rng->RollRandomIntInRange(0, m_meshLibrary->GetNumDebrisVariants() - 1));
+}
+
+//----------------------------------------------------------------------------------------------------
+void DebrisSystem::SpawnDebrisCluster(Vec2 const& position, Vec2 const& velocity, int const numDebris, float const radius, Rgba8 const& color)
+{
+    for (int debrisIndex = 0; debrisIndex < numDebris; ++debrisIndex)
+    {
+        float const randomRadius = g_rng->RollRandomFloatInRange(1.f, 5.f) * radius;
+        float const randomX      = g_rng->RollRandomFloatInRange(0.f, 360.f);
+        float const randomY      = g_rng->RollRandomFloatInRange(0.f, 360.f);
+
+        SpawnDebris(position, Vec2(velocity.x * randomX, velocity.y * randomY), randomRadius, color);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+int DebrisSystem::GetNumLive() const
+{
+    return m_numLive;
+}
+
+//----------------------------------------------------------------------------------------------------
+int DebrisSystem::GetCapacity() const
+{
+    return m_capacity;
+}
+
+//----------------------------------------------------------------------------------------------------
+int DebrisSystem::GetHighWaterMark() const
+{
+    return m_highWaterMark;
+}
+
+//----------------------------------------------------------------------------------------------------
+size_t DebrisSystem::GetNumBytesReserved() const
+{
+    return m_positions.capacity() * sizeof(Vec2) +
+           m_velocities.capacity() * sizeof(Vec2) +
+           m_orientationDegrees.capacity() * sizeof(float) +
+           m_angularVelocities.capacity() * sizeof(float) +
+           m_lifetimes.capacity() * sizeof(float) +
+           m_cosmeticRadii.capacity() * sizeof(float) +
+           m_colors.capacity() * sizeof(Rgba8) +
+           m_meshVariantIndices.capacity() * sizeof(uint8_t) +
+           m_visibleIndices.capacity() * sizeof(int);
+}
+
+//----------------------------------------------------------------------------------------------------
+bool DebrisSystem::IsOffScreen(int const debrisIndex) const
+{
+    Vec2 const  position       = m_positions[debrisIndex];
+    float const cosmeticRadius = m_cosmeticRadii[debrisIndex];
+
+    return
+        position.x < -cosmeticRadius ||
+        position.x > WORLD_SIZE_X + cosmeticRadius ||
+        position.y < -cosmeticRadius ||
+        position.y > WORLD_SIZE_Y + cosmeticRadius;
+}
+
+//----------------------------------------------------------------------------------------------------
+void DebrisSystem::KillDebris(int const debrisIndex)
+{
+    int const lastIndex = m_numLive - 1;
+
+    if (debrisIndex != lastIndex)
+    {
+        m_positions[debrisIndex]          = m_positions[lastIndex];
+        m_velocities[debrisIndex]         = m_velocities[lastIndex];
+        m_orientationDegrees[debrisIndex] = m_orientationDegrees[lastIndex];
+        m_angularVelocities[debrisIndex]  = m_angularVelocities[lastIndex];
+        m_lifetimes[debrisIndex]          = m_lifetimes[lastIndex];
+        m_cosmeticRadii[debrisIndex]      = m_cosmeticRadii[lastIndex];
+        m_colors[debrisIndex]             = m_colors[lastIndex];
+        m_meshVariantIndices[debrisIndex] = m_meshVariantIndices[lastIndex];
+    }
+
+    m_numLive = lastIndex;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Only reads the particle, so any number of threads may write different particles at once.
+//
+void DebrisSystem::WriteDebrisVerts(int const debrisIndex, Vertex_PCU* out_verts) const
+{
+    Vec2 const  position  = m_positions[debrisIndex];
+    float const scale     = m_cosmeticRadii[debrisIndex];
+    float const cosine    = CosDegrees(m_orientationDegrees[debrisIndex]) * scale;
+    float const sine      = SinDegrees(m_orientationDegrees[debrisIndex]) * scale;
+    Vec2 const* rimPoints = m_meshLibrary->GetDebrisRimPoints(m_meshVariantIndices[debrisIndex]);
+
+    Rgba8 color = m_colors[debrisIndex];
+    color.a     = static_cast<unsigned char>(static_cast<float>(color.a) * (m_lifetimes[debrisIndex] / DEBRIS_LIFETIME_SECONDS));
+
+    Vec3 rimPositions[DEBRIS_TRI_NUM];
+
+    for (int sideIndex = 0; sideIndex < DEBRIS_TRI_NUM; ++sideIndex)
+    {
+        Vec2 const local = rimPoints[sideIndex];
+
+        rimPositions[sideIndex] = Vec3(position.x + local.x * cosine - local.y * sine,
+                                       position.y + local.x * sine + local.y * cosine,
+                                       0.f);
+    }
+
+    Vec3 const centerPosition = Vec3(position.x, position.y, 0.f);
+
+    for (int sideIndex = 0; sideIndex < DEBRIS_TRI_NUM; ++sideIndex)
+    {
+        int const nextSideIndex = (sideIndex + 1) % DEBRIS_TRI_NUM;
+
+        out_verts[0] = Vertex_PCU(centerPosition, color);
+        out_verts[1] = Vertex_PCU(rimPositions[sideIndex], color);
+        out_verts[2] = Vertex_PCU(rimPositions[nextSideIndex], color);
+        out_verts    += 3;
+    }
+}
@@ -0,0 +1,67 @@
+//----------------------------------------------------------------------------------------------------
+// DebrisSystem.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+//----------------------------------------------------------------------------------------------------
+#include "Game/GameCommon.hpp"
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Renderer/Vertex_PCU.hpp"
+//----------------------------------------------------------------------------------------------------
+#include <cstdint>
+#include <vector>
+
+//----------------------------------------------------------------------------------------------------
+class MeshLibrary;
+class RenderBatcher;
+class WorkerPool;
+
+//----------------------------------------------------------------------------------------------------
+// Structure-of-arrays storage for every debris particle in the world.
+// Live particles are packed densely in [0, m_numLive); when one expires the last live particle is
+// moved into its slot, so Update and Render only ever walk live data. Render skips particles outside
+// the batcher's cull bounds and spreads the rest over the worker pool.
+//
+class DebrisSystem
+{
+public:
+    DebrisSystem(int capacity, MeshLibrary const* meshLibrary);
+
+    void Update(float deltaSeconds);
+    void Render(RenderBatcher& batcher, WorkerPool& workerPool);
+    void DebugRender(Vec2 const& playerShipPos, RenderBatcher& batcher) const;
+    void Clear();
+
+    void SpawnDebris(Vec2 const& position, Vec2 const& velocity, float radius, Rgba8 const& color);
+    void SpawnDebrisCluster(Vec2 const& position, Vec2 const& velocity, int numDebris, float radius, Rgba8 const& color);
+
+    int    GetNumLive() const;
+    int    GetCapacity() const;
+    int    GetHighWaterMark() const;
+    size_t GetNumBytesReserved() const;
+
+private:
+    bool IsOffScreen(int debrisIndex) const;
+    void KillDebris(int debrisIndex);
+    void WriteDebrisVerts(int debrisIndex, Vertex_PCU* out_verts) const; // DEBRIS_VERTS_NUM of them
+
+    MeshLibrary const* m_meshLibrary = nullptr;
+
+    int m_capacity      = 0;
+    int m_numLive       = 0;
+    int m_highWaterMark = 0; // most particles live at once since construction
+
+    // Hot data, touched by Update every frame
+    std::vector<Vec2>  m_positions;
+    std::vector<Vec2>  m_velocities;
+    std::vector<float> m_orientationDegrees;
+    std::vector<float> m_angularVelocities;
+    std::vector<float> m_lifetimes;
+    std::vector<float> m_cosmeticRadii;
+
+    // Cold data, only touched by Render
+    std::vector<Rgba8>   m_colors;
+    std::vector<uint8_t> m_meshVariantIndices; // shape is MeshLibrary's debris variant scaled by the cosmetic radius
+    std::vector<int>     m_visibleIndices;     // Render's scratch: live particles inside the cull bounds, in index order
+};
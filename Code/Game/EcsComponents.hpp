@@ -0,0 +1,192 @@
+//----------------------------------------------------------------------------------------------------
+// EcsComponents.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+//----------------------------------------------------------------------------------------------------
+#include "Game/EntityHandle.hpp"
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Core/Rgba8.hpp"
+#include "Engine/Math/Vec2.hpp"
+//----------------------------------------------------------------------------------------------------
+#include <cstdint>
+#include <type_traits>
+
+//----------------------------------------------------------------------------------------------------
+// Every entity kind is one archetype, i.e. one fixed set of components stored in its own chunks.
+//
+enum class eEntityKind : uint8_t
+{
+    PLAYER_SHIP,
+    BULLET,
+    ASTEROID,
+    BEETLE,
+    WASP,
+    NUM
+};
+
+//----------------------------------------------------------------------------------------------------
+// Component ids double as bit positions in an EcsMask. Ids below NUM_COLUMNS have a column in every
+// chunk of archetypes that carry them; tags only exist in the mask and cost no storage.
+//
+enum class eEcsComponent : uint8_t
+{
+    ENTITY_HANDLE,
+    TRANSFORM,
+    VELOCITY,
+    SPIN,
+    HEALTH,
+    COLLIDER,
+    MESH_REF,
+    PLAYER_CONTROL,
+    CHASE,
+    NUM_COLUMNS,
+
+    TAG_ENEMY = NUM_COLUMNS,       // counts toward clearing the wave and collides with the player ship
+    TAG_WRAP_AROUND,               // leaves one edge of the world, comes back at the opposite one
+    TAG_BOUNCE_OFF_WALLS,          // clamped inside the world, velocity reflected off the edges
+    TAG_CULL_OFF_SCREEN,           // becomes garbage once it leaves the world
+    NUM
+};
+
+using EcsMask = uint32_t;
+
+static_assert(static_cast<int>(eEcsComponent::NUM) <= 32, "EcsMask has one bit per component");
+
+constexpr EcsMask MakeEcsMask(eEcsComponent const component)
+{
+    return EcsMask{1} << static_cast<int>(component);
+}
+
+template <typename... Ts>
+constexpr EcsMask MakeEcsMask(eEcsComponent const first, Ts const... rest)
+{
+    return MakeEcsMask(first) | MakeEcsMask(rest...);
+}
+
+//----------------------------------------------------------------------------------------------------
+// Components are plain data: rows are moved between slots with memcpy and never destroyed.
+//
+struct sTransform
+{
+    Vec2  m_position;                 // world-space origin
+    float m_orientationDegrees = 0.f; // counter-clockwise from +x/east
+};
+
+struct sVelocity
+{
+    Vec2 m_velocity; // world units per second
+};
+
+struct sSpin
+{
+    float m_angularVelocity = 0.f; // degrees per second
+};
+
+struct sHealth
+{
+    int  m_health    = 1;     // how many 'hits' the entity can sustain before dying
+    bool m_isDead    = false; // dead entities are neither simulated nor rendered
+    bool m_isGarbage = false; // destroyed at the end of Game::Update()
+};
+
+struct sCollider
+{
+    float m_physicsRadius  = 0.f; // inner, conservative radius for physics
+    float m_cosmeticRadius = 0.f; // outer radius that encloses all of the entity's verts
+};
+
+enum class eMeshId : uint8_t
+{
+    PLAYER_SHIP,
+    BULLET,
+    ASTEROID,
+    BEETLE,
+    WASP
+};
+
+constexpr int MESH_ID_NUM = static_cast<int>(eMeshId::WASP) + 1;
+
+struct sMeshRef
+{
+    eMeshId m_meshId       = eMeshId::PLAYER_SHIP;
+    uint8_t m_variantIndex = 0;   // only used by meshes with random variants (asteroids)
+    float   m_scale        = 1.f; // uniform scale applied to the library verts
+    Rgba8   m_color;              // tint, unless the library mesh is already colored
+};
+
+struct sPlayerControl
+{
+    int   m_score                = 0;
+    float m_thrustRate           = 0.f;
+    bool  m_isTurningLeft        = false;
+    bool  m_isTurningRight       = false;
+    bool  m_isThrusting          = false;
+    bool  m_isReadyToSpawnBullet = false;
+};
+
+enum class eChaseStyle : uint8_t
+{
+    ACCELERATE, // Wasp: accelerates toward the target and keeps its momentum
+    STEER       // Beetle: faces the target and moves at a random speed every frame
+};
+
+struct sChase
+{
+    EntityHandle m_target;
+    eChaseStyle  m_style = eChaseStyle::ACCELERATE;
+};
+
+//----------------------------------------------------------------------------------------------------
+// Maps a component struct to its column id.
+//
+template <typename T>
+constexpr eEcsComponent ECS_COMPONENT_ID = eEcsComponent::NUM;
+
+template <> constexpr eEcsComponent ECS_COMPONENT_ID<EntityHandle>   = eEcsComponent::ENTITY_HANDLE;
+template <> constexpr eEcsComponent ECS_COMPONENT_ID<sTransform>     = eEcsComponent::TRANSFORM;
+template <> constexpr eEcsComponent ECS_COMPONENT_ID<sVelocity>      = eEcsComponent::VELOCITY;
+template <> constexpr eEcsComponent ECS_COMPONENT_ID<sSpin>          = eEcsComponent::SPIN;
+template <> constexpr eEcsComponent ECS_COMPONENT_ID<sHealth>        = eEcsComponent::HEALTH;
+template <> constexpr eEcsComponent ECS_COMPONENT_ID<sCollider>      = eEcsComponent::COLLIDER;
+template <> constexpr eEcsComponent ECS_COMPONENT_ID<sMeshRef>       = eEcsComponent::MESH_REF;
+template <> constexpr eEcsComponent ECS_COMPONENT_ID<sPlayerControl> = eEcsComponent::PLAYER_CONTROL;
+template <> constexpr eEcsComponent ECS_COMPONENT_ID<sChase>         = eEcsComponent::CHASE;
+
+template <typename T>
+constexpr int GetEcsColumnIndex()
+{
+    static_assert(ECS_COMPONENT_ID<T> < eEcsComponent::NUM_COLUMNS, "Type is not a registered ECS component");
+    static_assert(std::is_trivially_destructible_v<T>, "ECS components must be plain data");
+    static_assert(std::is_trivially_copyable_v<T>, "EcsArchetype moves rows with memcpy");
+
+    return static_cast<int>(ECS_COMPONENT_ID<T>);
+}
+
+//----------------------------------------------------------------------------------------------------
+// Component set of each entity kind, indexed by eEntityKind. Adding a kind means adding a row here,
+// in ENTITY_KIND_TRAITS and in ENTITY_COLLISION_MATRIX, and a Spawn function that fills in its
+// components; the systems pick it up through its mask.
+//
+constexpr EcsMask ECS_ARCHETYPE_MASKS[] =
+{
+    // PLAYER_SHIP
+    MakeEcsMask(eEcsComponent::TRANSFORM, eEcsComponent::VELOCITY, eEcsComponent::HEALTH, eEcsComponent::COLLIDER,
+                eEcsComponent::MESH_REF, eEcsComponent::PLAYER_CONTROL, eEcsComponent::TAG_BOUNCE_OFF_WALLS),
+    // BULLET
+    MakeEcsMask(eEcsComponent::TRANSFORM, eEcsComponent::VELOCITY, eEcsComponent::HEALTH, eEcsComponent::COLLIDER,
+                eEcsComponent::MESH_REF, eEcsComponent::TAG_CULL_OFF_SCREEN),
+    // ASTEROID
+    MakeEcsMask(eEcsComponent::TRANSFORM, eEcsComponent::VELOCITY, eEcsComponent::SPIN, eEcsComponent::HEALTH,
+                eEcsComponent::COLLIDER, eEcsComponent::MESH_REF, eEcsComponent::TAG_ENEMY,
+                eEcsComponent::TAG_WRAP_AROUND),
+    // BEETLE
+    MakeEcsMask(eEcsComponent::TRANSFORM, eEcsComponent::VELOCITY, eEcsComponent::HEALTH, eEcsComponent::COLLIDER,
+                eEcsComponent::MESH_REF, eEcsComponent::CHASE, eEcsComponent::TAG_ENEMY),
+    // WASP
+    MakeEcsMask(eEcsComponent::TRANSFORM, eEcsComponent::VELOCITY, eEcsComponent::HEALTH, eEcsComponent::COLLIDER,
+                eEcsComponent::MESH_REF, eEcsComponent::CHASE, eEcsComponent::TAG_ENEMY),
+};
+
+static_assert(sizeof(ECS_ARCHETYPE_MASKS) / sizeof(ECS_ARCHETYPE_MASKS[0]) == static_cast<size_t>(eEntityKind::NUM), "Every entity kind needs an archetype mask");
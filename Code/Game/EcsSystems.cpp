@@ -0,0 +1,331 @@
+//----------------------------------------------------------------------------------------------------
+// EcsSystems.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/EcsSystems.hpp"
+//----------------------------------------------------------------------------------------------------
+#include "Game/EcsWorld.hpp"
+#include "Game/Game.hpp"
+#include "Game/GameCommon.hpp"
+#include "Game/MeshLibrary.hpp"
+#include "Game/RenderBatcher.hpp"
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Input/InputSystem.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Math/RandomNumberGenerator.hpp"
+
+//----------------------------------------------------------------------------------------------------
+void PlayerControlSystem::Update(EcsWorld& world, float const deltaSeconds)
+{
+    XboxController const& controller = g_input->GetController(0); // #TODO: support multiple players
+
+    world.ForEach<sTransform, sVelocity, sHealth, sPlayerControl>([&](sTransform& transform, sVelocity& velocity, sHealth const& health, sPlayerControl& control)
+    {
+        Vec2 const bulletPosition = transform.m_position + Vec2::MakeFromPolarDegrees(transform.m_orientationDegrees);
+
+        // Keyboard
+        control.m_isTurningLeft  = g_input->IsKeyDown(KEYCODE_A);
+        control.m_isTurningRight = g_input->IsKeyDown(KEYCODE_D);
+
+        if (g_input->WasKeyJustPressed(KEYCODE_SPACE) &&
+            control.m_isReadyToSpawnBullet &&
+            !health.m_isDead)
+            g_game->SpawnBullet(bulletPosition, transform.m_orientationDegrees);
+
+        // Controller
+        if (controller.WasButtonJustPressed(XBOX_BUTTON_A))
+        {
+            g_game->SpawnBullet(bulletPosition, transform.m_orientationDegrees);
+        }
+
+        if (g_input->IsKeyDown(KEYCODE_W))
+        {
+            control.m_isThrusting = true;
+            control.m_thrustRate  = 1.f;
+        }
+        else if (controller.GetLeftStick().GetMagnitude() > 0.f)
+        {
+            control.m_isThrusting          = true;
+            control.m_thrustRate           = controller.GetLeftStick().GetMagnitude();
+            transform.m_orientationDegrees = controller.GetLeftStick().GetOrientationDegrees();
+        }
+        else
+        {
+            control.m_isThrusting = false;
+            control.m_thrustRate  = 0.f;
+        }
+
+        if (health.m_isDead) return;
+
+        if (control.m_isThrusting)
+        {
+            Vec2 const fwdNormal    = Vec2::MakeFromPolarDegrees(transform.m_orientationDegrees);
+            Vec2 const acceleration = fwdNormal * PLAYER_SHIP_ACCELERATION * control.m_thrustRate;
+
+            velocity.m_velocity += acceleration * deltaSeconds;
+        }
+
+        if (control.m_isTurningLeft) transform.m_orientationDegrees += PLAYER_SHIP_TURN_SPEED * deltaSeconds;
+        if (control.m_isTurningRight) transform.m_orientationDegrees -= PLAYER_SHIP_TURN_SPEED * deltaSeconds;
+    });
+}
+
+//----------------------------------------------------------------------------------------------------
+void ChaseSystem::Update(EcsWorld& world, float const deltaSeconds)
+{
+    world.ForEach<sTransform, sVelocity, sHealth, sChase>([&world, deltaSeconds](sTransform& transform, sVelocity& velocity, sHealth const& health, sChase& chase)
+    {
+        if (health.m_isDead) return;
+
+        sTransform const* target = world.Get<sTransform>(chase.m_target);
+
+        // The ship being chased was destroyed (e.g. on respawn), so re-acquire the current one
+        if (target == nullptr)
+        {
+            chase.m_target = g_game->GetPlayerShipHandle();
+            target         = world.Get<sTransform>(chase.m_target);
+        }
+
+        sHealth const* targetHealth = world.Get<sHealth>(chase.m_target);
+
+        if (target != nullptr &&
+            targetHealth != nullptr &&
+            !targetHealth->m_isDead)
+        {
+            Vec2 const directionToTarget = (target->m_position - transform.m_position).GetNormalized();
+            transform.m_orientationDegrees = directionToTarget.GetOrientationDegrees();
+
+            if (chase.m_style == eChaseStyle::ACCELERATE)
+            {
+                Vec2 const acceleration = Vec2::MakeFromPolarDegrees(transform.m_orientationDegrees) * WASP_ACCELERATION;
+
+                velocity.m_velocity += acceleration * deltaSeconds;
+            }
+        }
+
+        if (chase.m_style == eChaseStyle::STEER)
+        {
+            float const beetleSpeed = g_rng->RollRandomFloatInRange(5.f, 12.f);
+            velocity.m_velocity     = Vec2::MakeFromPolarDegrees(transform.m_orientationDegrees, beetleSpeed);
+        }
+    });
+}
+
+//----------------------------------------------------------------------------------------------------
+void MovementSystem::Update(EcsWorld& world, float const deltaSeconds)
+{
+    world.ForEachChunk<sTransform, sVelocity, sHealth>([deltaSeconds](int const numRows, sTransform* transforms, sVelocity const* velocities, sHealth const* healths)
+    {
+        for (int rowIndex = 0; rowIndex < numRows; ++rowIndex)
+        {
+            if (healths[rowIndex].m_isDead) continue;
+
+            transforms[rowIndex].m_position += velocities[rowIndex].m_velocity * deltaSeconds;
+        }
+    });
+}
+
+//----------------------------------------------------------------------------------------------------
+void SpinSystem::Update(EcsWorld& world, float const deltaSeconds)
+{
+    world.ForEachChunk<sTransform, sSpin, sHealth>([deltaSeconds](int const numRows, sTransform* transforms, sSpin const* spins, sHealth const* healths)
+    {
+        for (int rowIndex = 0; rowIndex < numRows; ++rowIndex)
+        {
+            if (healths[rowIndex].m_isDead) continue;
+
+            transforms[rowIndex].m_orientationDegrees += spins[rowIndex].m_angularVelocity * deltaSeconds;
+        }
+    });
+}
+
+//----------------------------------------------------------------------------------------------------
+void WrapAroundSystem::Update(EcsWorld& world, float const deltaSeconds)
+{
+    UNUSED(deltaSeconds)
+
+    world.ForEach<sTransform, sHealth, sCollider>([](sTransform& transform, sHealth const& health, sCollider const& collider)
+    {
+        if (health.m_isDead) return;
+
+        Vec2&       position       = transform.m_position;
+        float const cosmeticRadius = collider.m_cosmeticRadius;
+
+        if (position.x > WORLD_SIZE_X + cosmeticRadius)
+        {
+            position.x = 0.f;
+        }
+        else if (position.x < -cosmeticRadius)
+        {
+            position.x = WORLD_SIZE_X;
+        }
+
+        if (position.y > WORLD_SIZE_Y + cosmeticRadius)
+        {
+            position.y = 0.f;
+        }
+        else if (position.y < -cosmeticRadius)
+        {
+            position.y = WORLD_SIZE_Y;
+        }
+    }, MakeEcsMask(eEcsComponent::TAG_WRAP_AROUND));
+}
+
+//----------------------------------------------------------------------------------------------------
+void BounceOffWallsSystem::Update(EcsWorld& world, float const deltaSeconds)
+{
+    UNUSED(deltaSeconds)
+
+    world.ForEach<sTransform, sVelocity, sHealth, sCollider>([](sTransform& transform, sVelocity& velocity, sHealth const& health, sCollider const& collider)
+    {
+        if (health.m_isDead) return;
+
+        Vec2&       position      = transform.m_position;
+        Vec2&       linear        = velocity.m_velocity;
+        float const physicsRadius = collider.m_physicsRadius;
+
+        // The entity sticks to the bound no matter how fast it is moving
+        if (position.x < physicsRadius)
+        {
+            position.x = physicsRadius;
+            linear.x   = -linear.x;
+        }
+
+        if (position.x > WORLD_SIZE_X - physicsRadius)
+        {
+            position.x = WORLD_SIZE_X - physicsRadius;
+            linear.x   = -linear.x;
+        }
+
+        if (position.y < physicsRadius)
+        {
+            position.y = physicsRadius;
+            linear.y   = -linear.y;
+        }
+
+        if (position.y > WORLD_SIZE_Y - physicsRadius)
+        {
+            position.y = WORLD_SIZE_Y - physicsRadius;
+            linear.y   = -linear.y;
+        }
+    }, MakeEcsMask(eEcsComponent::TAG_BOUNCE_OFF_WALLS));
+}
+
+//----------------------------------------------------------------------------------------------------
+void OffScreenCullSystem::Update(EcsWorld& world, float const deltaSeconds)
+{
+    UNUSED(deltaSeconds)
+
+    world.ForEach<sTransform, sHealth, sCollider>([](sTransform const& transform, sHealth& health, sCollider const& collider)
+    {
+        Vec2 const  position       = transform.m_position;
+        float const cosmeticRadius = collider.m_cosmeticRadius;
+
+        bool const isOffScreen =
+            position.x < -cosmeticRadius ||
+            position.x > WORLD_SIZE_X + cosmeticRadius ||
+            position.y < -cosmeticRadius ||
+            position.y > WORLD_SIZE_Y + cosmeticRadius;
+
+        if (!isOffScreen) return;
+
+        health.m_isDead    = true;
+        health.m_isGarbage = true;
+    }, MakeEcsMask(eEcsComponent::TAG_CULL_OFF_SCREEN));
+}
+
+//----------------------------------------------------------------------------------------------------
+EntityRenderSystem::EntityRenderSystem(MeshLibrary const* meshLibrary, RenderBatcher& batcher)
+{
+    for (int meshIdIndex = 0; meshIdIndex < MESH_ID_NUM; ++meshIdIndex)
+    {
+        eMeshId const meshId      = static_cast<eMeshId>(meshIdIndex);
+        int const     numVariants = meshId == eMeshId::ASTEROID ? meshLibrary->GetNumAsteroidVariants() : 1;
+
+        for (int variantIndex = 0; variantIndex < numVariants; ++variantIndex)
+        {
+            int const meshIndex = batcher.RegisterMesh(meshLibrary->GetVerts(meshId, variantIndex), MeshLibrary::GetNumVerts(meshId), MeshLibrary::IsPreColored(meshId));
+
+            if (variantIndex == 0) m_firstMeshIndices[meshIdIndex] = meshIndex;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// Entities whose cosmetic disc lies outside the batcher's cull bounds never become instances.
+//
+void EntityRenderSystem::Render(EcsWorld const& world, eEntityKind const kind, RenderBatcher& batcher) const
+{
+    int numCulled = 0;
+
+    world.ForEachOfKind<sTransform, sHealth, sMeshRef, sCollider>(kind, [this, &batcher, &numCulled](sTransform const& transform, sHealth const& health, sMeshRef const& meshRef, sCollider const& collider)
+    {
+        if (health.m_isDead) return;
+
+        if (!batcher.IsDiscVisible(transform.m_position, collider.m_cosmeticRadius))
+        {
+            ++numCulled;
+            return;
+        }
+
+        int const variantIndex = meshRef.m_meshId == eMeshId::ASTEROID ? meshRef.m_variantIndex : 0;
+
+        batcher.AppendInstance(sRenderState(),
+                               m_firstMeshIndices[static_cast<int>(meshRef.m_meshId)] + variantIndex,
+                               sShapeInstance{transform.m_position, transform.m_orientationDegrees, meshRef.m_scale, meshRef.m_color});
+    });
+
+    batcher.AddNumCulled(numCulled);
+}
+
+//----------------------------------------------------------------------------------------------------
+// Culled like Render, with the disc grown to take in the velocity line; the line to the player ship
+// goes with its entity.
+//
+void EntityRenderSystem::DebugRender(EcsWorld const& world, eEntityKind const kind, Vec2 const* playerShipPos, RenderBatcher& batcher) const
+{
+    world.ForEachOfKind<sTransform, sVelocity, sCollider>(kind, [playerShipPos, &batcher](sTransform const& transform, sVelocity const& velocity, sCollider const& collider)
+    {
+        if (!batcher.IsDiscVisible(transform.m_position, collider.m_cosmeticRadius + velocity.m_velocity.GetLength())) return;
+
+        Vec2 const position  = transform.m_position;
+        Vec2 const fwdNormal = Vec2::MakeFromPolarDegrees(transform.m_orientationDegrees);
+
+        if (playerShipPos != nullptr)
+        {
+            DebugDrawLine(batcher,
+                          *playerShipPos,
+                          position,
+                          0.2f,
+                          DEBUG_RENDER_GREY);
+        }
+
+        DebugDrawLine(batcher,
+                      position,
+                      position + fwdNormal * collider.m_cosmeticRadius,
+                      0.2f,
+                      DEBUG_RENDER_RED);
+        DebugDrawLine(batcher,
+                      position,
+                      position + fwdNormal.GetRotated90Degrees() * collider.m_cosmeticRadius,
+                      0.2f,
+                      DEBUG_RENDER_GREEN);
+        DebugDrawRing(batcher,
+                      position,
+                      collider.m_cosmeticRadius,
+                      0.2f,
+                      DEBUG_RENDER_MAGENTA);
+        DebugDrawRing(batcher,
+                      position,
+                      collider.m_physicsRadius,
+                      0.2f,
+                      DEBUG_RENDER_CYAN);
+        DebugDrawLine(batcher,
+                      position,
+                      position + velocity.m_velocity,
+                      0.2f,
+                      DEBUG_RENDER_YELLOW);
+    });
+}
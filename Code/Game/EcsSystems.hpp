@@ -0,0 +1,109 @@
+//----------------------------------------------------------------------------------------------------
+// EcsSystems.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+//----------------------------------------------------------------------------------------------------
+#include "Game/EcsComponents.hpp"
+//----------------------------------------------------------------------------------------------------
+#include <tuple>
+
+//----------------------------------------------------------------------------------------------------
+class EcsWorld;
+class MeshLibrary;
+class RenderBatcher;
+
+//----------------------------------------------------------------------------------------------------
+// A system owns one behaviour and runs it over every chunk whose archetype carries the components it
+// needs, so the per-frame cost is one call per system rather than one per entity.
+// Systems share no base class: each one is a plain type with a non-virtual Update(EcsWorld&, float),
+// and EcsSystemList binds a fixed sequence of them at compile time.
+// Dead entities are skipped unless noted.
+//
+template <typename... Systems>
+class EcsSystemList
+{
+public:
+    // Runs every system once, in template-argument order
+    void Update(EcsWorld& world, float const deltaSeconds)
+    {
+        (std::get<Systems>(m_systems).Update(world, deltaSeconds), ...);
+    }
+
+private:
+    std::tuple<Systems...> m_systems;
+};
+
+//----------------------------------------------------------------------------------------------------
+// Keyboard / controller input, thrust and turning; fires bullets through Game::SpawnBullet.
+// Input is read even while dead so a queued shot or turn is not lost across a respawn.
+class PlayerControlSystem
+{
+public:
+    void Update(EcsWorld& world, float deltaSeconds);
+};
+
+//----------------------------------------------------------------------------------------------------
+// Beetle and Wasp steering toward their target; re-acquires the current player ship once the handle
+// goes stale.
+class ChaseSystem
+{
+public:
+    void Update(EcsWorld& world, float deltaSeconds);
+};
+
+//----------------------------------------------------------------------------------------------------
+class MovementSystem
+{
+public:
+    void Update(EcsWorld& world, float deltaSeconds);
+};
+
+//----------------------------------------------------------------------------------------------------
+class SpinSystem
+{
+public:
+    void Update(EcsWorld& world, float deltaSeconds);
+};
+
+//----------------------------------------------------------------------------------------------------
+class WrapAroundSystem
+{
+public:
+    void Update(EcsWorld& world, float deltaSeconds);
+};
+
+//----------------------------------------------------------------------------------------------------
+class BounceOffWallsSystem
+{
+public:
+    void Update(EcsWorld& world, float deltaSeconds);
+};
+
+//----------------------------------------------------------------------------------------------------
+// Flags TAG_CULL_OFF_SCREEN entities as garbage once they are fully outside the world, dead or not.
+class OffScreenCullSystem
+{
+public:
+    void Update(EcsWorld& world, float deltaSeconds);
+};
+
+//----------------------------------------------------------------------------------------------------
+// Submits every live entity of one kind inside the batcher's cull bounds to the frame's RenderBatcher
+// as one sShapeInstance of its library mesh, registered with the batcher on construction (each
+// asteroid variant on its own).
+//
+class EntityRenderSystem
+{
+public:
+    EntityRenderSystem(MeshLibrary const* meshLibrary, RenderBatcher& batcher);
+
+    void Render(EcsWorld const& world, eEntityKind kind, RenderBatcher& batcher) const;
+
+    // Collider, orientation and velocity gizmos; a grey line to the player ship when it is given
+    void DebugRender(EcsWorld const& world, eEntityKind kind, Vec2 const* playerShipPos, RenderBatcher& batcher) const;
+
+private:
+    int m_firstMeshIndices[MESH_ID_NUM] = {}; // batcher mesh index of each eMeshId's first variant
+};
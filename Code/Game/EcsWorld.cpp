@@ -0,0 +1,338 @@
+//----------------------------------------------------------------------------------------------------
+// EcsWorld.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/EcsWorld.hpp"
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Core/ErrorWarningAssert.hpp"
+//----------------------------------------------------------------------------------------------------
+#include <cstring>
+#include <new>
+
+//----------------------------------------------------------------------------------------------------
+struct sEcsColumnInfo
+{
+    int m_size;
+    void (*m_construct)(void* destination);
+};
+
+template <typename T>
+static constexpr sEcsColumnInfo MakeEcsColumnInfo()
+{
+    static_assert(alignof(T) <= ECS_COLUMN_ALIGNMENT, "Columns start on ECS_COLUMN_ALIGNMENT boundaries");
+
+    return {static_cast<int>(sizeof(T)), [](void* destination) { new (destination) T(); }};
+}
+
+//----------------------------------------------------------------------------------------------------
+// Indexed by eEcsComponent; the order must match the enum
+static constexpr sEcsColumnInfo ECS_COLUMN_INFOS[] =
+{
+    MakeEcsColumnInfo<EntityHandle>(),
+    MakeEcsColumnInfo<sTransform>(),
+    MakeEcsColumnInfo<sVelocity>(),
+    MakeEcsColumnInfo<sSpin>(),
+    MakeEcsColumnInfo<sHealth>(),
+    MakeEcsColumnInfo<sCollider>(),
+    MakeEcsColumnInfo<sMeshRef>(),
+    MakeEcsColumnInfo<sPlayerControl>(),
+    MakeEcsColumnInfo<sChase>(),
+};
+
+static_assert(sizeof(ECS_COLUMN_INFOS) / sizeof(ECS_COLUMN_INFOS[0]) == ECS_COMPONENT_COLUMNS, "Every ECS column needs an entry in ECS_COLUMN_INFOS");
+
+//----------------------------------------------------------------------------------------------------
+EcsArchetype::EcsArchetype(eEntityKind const kind, EcsMask const mask, int const capacity)
+    : m_kind(kind),
+      m_mask(mask | MakeEcsMask(eEcsComponent::ENTITY_HANDLE)),
+      m_capacity(capacity)
+{
+    // Worst case every column loses (ECS_COLUMN_ALIGNMENT - 1) bytes to padding
+    int rowStride     = 0;
+    int columnPadding = 0;
+
+    for (int columnIndex = 0; columnIndex < ECS_COMPONENT_COLUMNS; ++columnIndex)
+    {
+        m_columnOffsets[columnIndex] = -1;
+
+        if ((m_mask & (EcsMask{1} << columnIndex)) == 0) continue;
+
+        m_columnSizes[columnIndex] = ECS_COLUMN_INFOS[columnIndex].m_size;
+        rowStride                  += ECS_COLUMN_INFOS[columnIndex].m_size;
+        columnPadding              += ECS_COLUMN_ALIGNMENT - 1;
+    }
+
+    m_rowsPerChunk = (ECS_CHUNK_BYTES - columnPadding) / rowStride;
+
+    int offset = 0;
+
+    for (int columnIndex = 0; columnIndex < ECS_COMPONENT_COLUMNS; ++columnIndex)
+    {
+        if (m_columnSizes[columnIndex] == 0) continue;
+
+        offset                       = (offset + ECS_COLUMN_ALIGNMENT - 1) / ECS_COLUMN_ALIGNMENT * ECS_COLUMN_ALIGNMENT;
+        m_columnOffsets[columnIndex] = offset;
+        offset                       += m_columnSizes[columnIndex] * m_rowsPerChunk;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+int EcsArchetype::GetNumChunksForCapacity() const
+{
+    return (m_capacity + m_rowsPerChunk - 1) / m_rowsPerChunk;
+}
+
+//----------------------------------------------------------------------------------------------------
+int EcsArchetype::AddRow(SlabAllocator<sEcsChunk>& chunkAllocator)
+{
+    int const row = m_stats.m_numLive;
+
+    // Chunks are kept once acquired, so this only allocates the first time the archetype grows this far
+    if (row == GetNumChunks() * m_rowsPerChunk)
+    {
+        m_chunks.push_back(static_cast<sEcsChunk*>(chunkAllocator.Allocate()));
+    }
+
+    int const      chunkIndex = row / m_rowsPerChunk;
+    int const      chunkRow   = row % m_rowsPerChunk;
+    unsigned char* chunkBytes = m_chunks[chunkIndex]->m_bytes;
+
+    for (int columnIndex = 0; columnIndex < ECS_COMPONENT_COLUMNS; ++columnIndex)
+    {
+        if (m_columnOffsets[columnIndex] < 0) continue;
+
+        ECS_COLUMN_INFOS[columnIndex].m_construct(chunkBytes + m_columnOffsets[columnIndex] + chunkRow * m_columnSizes[columnIndex]);
+    }
+
+    ++m_stats.m_numLive;
+    ++m_stats.m_numSpawned;
+
+    if (m_stats.m_numLive > m_stats.m_highWaterMark)
+    {
+        m_stats.m_highWaterMark = m_stats.m_numLive;
+    }
+
+    return row;
+}
+
+//----------------------------------------------------------------------------------------------------
+EntityHandle EcsArchetype::RemoveRow(int const row)
+{
+    int const lastRow = m_stats.m_numLive - 1;
+
+    --m_stats.m_numLive;
+    ++m_stats.m_numDestroyed;
+
+    if (row == lastRow) return EntityHandle();
+
+    unsigned char*       toBytes   = m_chunks[row / m_rowsPerChunk]->m_bytes;
+    unsigned char const* fromBytes = m_chunks[lastRow / m_rowsPerChunk]->m_bytes;
+    int const            toRow     = row % m_rowsPerChunk;
+    int const            fromRow   = lastRow % m_rowsPerChunk;
+
+    for (int columnIndex = 0; columnIndex < ECS_COMPONENT_COLUMNS; ++columnIndex)
+    {
+        if (m_columnOffsets[columnIndex] < 0) continue;
+
+        int const columnSize   = m_columnSizes[columnIndex];
+        int const columnOffset = m_columnOffsets[columnIndex];
+
+        std::memcpy(toBytes + columnOffset + toRow * columnSize, fromBytes + columnOffset + fromRow * columnSize, columnSize);
+    }
+
+    return *GetComponent<EntityHandle>(row);
+}
+
+//----------------------------------------------------------------------------------------------------
+EcsWorld::~EcsWorld()
+{
+    for (EcsArchetype*& archetype : m_archetypes)
+    {
+        delete archetype;
+        archetype = nullptr;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void EcsWorld::RegisterArchetype(eEntityKind const kind, EcsMask const mask, int const capacity)
+{
+    int const kindIndex = static_cast<int>(kind);
+
+    if (m_archetypes[kindIndex] != nullptr)
+    {
+        ERROR_RECOVERABLE("Archetype is already registered")
+        return;
+    }
+
+    // The directory holds one record per entity that can be live at once; past INDEX_MASK two live
+    // entities would share a handle index
+    size_t const numRecords = m_numMaxRecords + static_cast<size_t>(capacity);
+
+    GUARANTEE_OR_DIE(numRecords <= EntityHandle::INDEX_MASK, "Total archetype capacity exceeds EntityHandle index range")
+
+    EcsArchetype* archetype = new EcsArchetype(kind, mask, capacity);
+    m_archetypes[kindIndex] = archetype;
+    m_numMaxRecords         = numRecords;
+
+    m_records.reserve(numRecords);
+    m_freeRecords.reserve(numRecords);
+
+    int numReservedChunks = 0;
+
+    for (EcsArchetype const* registered : m_archetypes)
+    {
+        if (registered != nullptr) numReservedChunks += registered->GetNumChunksForCapacity();
+    }
+
+    m_chunkAllocator.Reserve(numReservedChunks);
+}
+
+//----------------------------------------------------------------------------------------------------
+EntityHandle EcsWorld::Spawn(eEntityKind const kind)
+{
+    EcsArchetype& archetype = *m_archetypes[static_cast<int>(kind)];
+
+    if (archetype.GetNumEntities() >= archetype.GetCapacity())
+    {
+        archetype.OnSpawnFailed();
+        return EntityHandle();
+    }
+
+    int recordIndex;
+
+    if (!m_freeRecords.empty())
+    {
+        recordIndex = m_freeRecords.back();
+        m_freeRecords.pop_back();
+    }
+    else
+    {
+        recordIndex = static_cast<int>(m_records.size());
+        m_records.emplace_back();
+    }
+
+    sEntityRecord& record = m_records[recordIndex];
+    record.m_kind         = kind;
+    record.m_row          = archetype.AddRow(m_chunkAllocator);
+
+    EntityHandle const handle = EntityHandle(recordIndex, record.m_generation);
+
+    *archetype.GetComponent<EntityHandle>(record.m_row) = handle;
+
+    return handle;
+}
+
+//----------------------------------------------------------------------------------------------------
+void EcsWorld::Destroy(EntityHandle const handle)
+{
+    sEntityRecord const* record = ResolveRecord(handle);
+
+    if (record == nullptr) return;
+
+    DestroyRow(*m_archetypes[static_cast<int>(record->m_kind)], record->m_row);
+}
+
+//----------------------------------------------------------------------------------------------------
+void EcsWorld::DestroyGarbage()
+{
+    for (EcsArchetype* archetype : m_archetypes)
+    {
+        if (archetype == nullptr || !archetype->HasComponents(MakeEcsMask(eEcsComponent::HEALTH))) continue;
+
+        int row = 0;
+
+        while (row < archetype->GetNumEntities())
+        {
+            if (archetype->GetComponent<sHealth>(row)->m_isGarbage)
+            {
+                // The last row now sits at 'row', so don't advance
+                DestroyRow(*archetype, row);
+                continue;
+            }
+
+            ++row;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void EcsWorld::Clear()
+{
+    for (EcsArchetype* archetype : m_archetypes)
+    {
+        if (archetype == nullptr) continue;
+
+        while (archetype->GetNumEntities() > 0)
+        {
+            DestroyRow(*archetype, archetype->GetNumEntities() - 1);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+bool EcsWorld::IsAlive(EntityHandle const handle) const
+{
+    return ResolveRecord(handle) != nullptr;
+}
+
+//----------------------------------------------------------------------------------------------------
+eEntityKind EcsWorld::GetKind(EntityHandle const handle) const
+{
+    sEntityRecord const* record = ResolveRecord(handle);
+
+    return record != nullptr ? record->m_kind : eEntityKind::NUM;
+}
+
+//----------------------------------------------------------------------------------------------------
+EcsArchetype const& EcsWorld::GetArchetype(eEntityKind const kind) const
+{
+    return *m_archetypes[static_cast<int>(kind)];
+}
+
+//----------------------------------------------------------------------------------------------------
+sSlabAllocatorStats const& EcsWorld::GetChunkAllocatorStats() const
+{
+    return m_chunkAllocator.GetStats();
+}
+
+//----------------------------------------------------------------------------------------------------
+size_t EcsWorld::GetDirectoryBytesReserved() const
+{
+    return m_records.capacity() * sizeof(sEntityRecord) + m_freeRecords.capacity() * sizeof(int);
+}
+
+//----------------------------------------------------------------------------------------------------
+EcsWorld::sEntityRecord const* EcsWorld::ResolveRecord(EntityHandle const handle) const
+{
+    if (!handle.IsValid()) return nullptr;
+
+    size_t const recordIndex = static_cast<size_t>(handle.GetIndex());
+
+    if (recordIndex >= m_records.size()) return nullptr;
+
+    sEntityRecord const& record = m_records[recordIndex];
+
+    if (record.m_row < 0 || record.m_generation != handle.GetGeneration()) return nullptr;
+
+    return &record;
+}
+
+//----------------------------------------------------------------------------------------------------
+void EcsWorld::DestroyRow(EcsArchetype& archetype, int const row)
+{
+    int const recordIndex = archetype.GetComponent<EntityHandle>(row)->GetIndex();
+
+    EntityHandle const movedHandle = archetype.RemoveRow(row);
+
+    if (movedHandle.IsValid())
+    {
+        m_records[movedHandle.GetIndex()].m_row = row;
+    }
+
+    sEntityRecord& record = m_records[recordIndex];
+    record.m_row          = -1;
+    record.m_generation   = static_cast<uint16_t>((record.m_generation + 1u) & EntityHandle::GENERATION_MASK);
+
+    m_freeRecords.push_back(recordIndex);
+}
@@ -0,0 +1,239 @@
+//----------------------------------------------------------------------------------------------------
+// EcsWorld.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+//----------------------------------------------------------------------------------------------------
+#include "Game/EcsComponents.hpp"
+#include "Game/SlabAllocator.hpp"
+//----------------------------------------------------------------------------------------------------
+#include <cstdint>
+#include <vector>
+
+//----------------------------------------------------------------------------------------------------
+constexpr int ECS_CHUNK_BYTES       = 16 * 1024;
+constexpr int ECS_COLUMN_ALIGNMENT  = 64;
+constexpr int ECS_ENTITY_KIND_NUM   = static_cast<int>(eEntityKind::NUM);
+constexpr int ECS_COMPONENT_COLUMNS = static_cast<int>(eEcsComponent::NUM_COLUMNS);
+
+//----------------------------------------------------------------------------------------------------
+struct alignas(ECS_COLUMN_ALIGNMENT) sEcsChunk
+{
+    unsigned char m_bytes[ECS_CHUNK_BYTES];
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sEcsArchetypeStats
+{
+    int m_numLive         = 0;
+    int m_highWaterMark   = 0;
+    int m_numSpawned      = 0;
+    int m_numDestroyed    = 0;
+    int m_numFailedSpawns = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+// All entities sharing one component mask.
+// Each chunk holds up to GetRowsPerChunk() rows as one cache-line-aligned array per component, and
+// rows are kept packed: row r lives in chunk r / rowsPerChunk, so systems walk every column of a
+// chunk front to back without gaps or per-entity indirection.
+//
+class EcsArchetype
+{
+public:
+    EcsArchetype(eEntityKind kind, EcsMask mask, int capacity);
+
+    eEntityKind               GetKind() const { return m_kind; }
+    EcsMask                   GetMask() const { return m_mask; }
+    bool                      HasComponents(EcsMask const mask) const { return (m_mask & mask) == mask; }
+    int                       GetNumEntities() const { return m_stats.m_numLive; }
+    int                       GetCapacity() const { return m_capacity; }
+    int                       GetRowsPerChunk() const { return m_rowsPerChunk; }
+    int                       GetNumChunks() const { return static_cast<int>(m_chunks.size()); }
+    int                       GetNumChunksForCapacity() const;
+    size_t                    GetNumBytesReserved() const { return static_cast<size_t>(GetNumChunksForCapacity()) * ECS_CHUNK_BYTES; }
+    sEcsArchetypeStats const& GetStats() const { return m_stats; }
+
+    // Column arrays start at row (chunkIndex * rowsPerChunk); the archetype must carry T
+    template <typename T>
+    T* GetColumn(int chunkIndex) const;
+
+    template <typename T>
+    T* GetComponent(int row) const;
+
+private:
+    friend class EcsWorld;
+
+    int          AddRow(SlabAllocator<sEcsChunk>& chunkAllocator);
+    EntityHandle RemoveRow(int row); // swap-removes; returns the handle of the entity moved into 'row'
+    void         OnSpawnFailed() { ++m_stats.m_numFailedSpawns; }
+
+    eEntityKind             m_kind;
+    EcsMask                 m_mask;
+    int                     m_capacity                             = 0;
+    int                     m_rowsPerChunk                         = 0;
+    int                     m_columnOffsets[ECS_COMPONENT_COLUMNS] = {}; // byte offset in each chunk, or -1
+    int                     m_columnSizes[ECS_COMPONENT_COLUMNS]   = {};
+    std::vector<sEcsChunk*> m_chunks;
+    sEcsArchetypeStats      m_stats;
+};
+
+//----------------------------------------------------------------------------------------------------
+// Archetype-based entity storage.
+// Entities are identified by generational EntityHandles that index a directory of (kind, row)
+// records; the directory entry is patched whenever a swap-remove moves a row, so handles stay valid
+// while storage stays packed. Chunks come from one SlabAllocator reserved for every archetype's
+// capacity at registration, so spawning and destroying never touch the general-purpose heap.
+//
+// Spawning during iteration is allowed (new rows are picked up by the next pass); destroying is not,
+// so systems flag sHealth::m_isGarbage and DestroyGarbage() sweeps once per frame.
+//
+class EcsWorld
+{
+public:
+    EcsWorld() = default;
+    ~EcsWorld();
+
+    EcsWorld(EcsWorld const&)            = delete;
+    EcsWorld& operator=(EcsWorld const&) = delete;
+
+    void RegisterArchetype(eEntityKind kind, EcsMask mask, int capacity);
+
+    // Components start default-initialized; returns an invalid handle if the archetype is full
+    EntityHandle Spawn(eEntityKind kind);
+    void         Destroy(EntityHandle handle);
+    void         DestroyGarbage();
+    void         Clear();
+
+    bool        IsAlive(EntityHandle handle) const;
+    eEntityKind GetKind(EntityHandle handle) const; // eEntityKind::NUM if the handle is stale
+
+    // Returns nullptr if the handle is stale or the entity's archetype has no T
+    template <typename T>
+    T* Get(EntityHandle handle) const;
+
+    // 'func' is called as func(int numRows, Ts*... columns) once per chunk of every archetype that
+    // carries all of Ts and every bit of 'requiredMask'
+    template <typename... Ts, typename Func>
+    void ForEachChunk(Func&& func, EcsMask requiredMask = 0) const;
+
+    // Per-entity versions of ForEachChunk: 'func' is called as func(Ts&... components), in row order
+    template <typename... Ts, typename Func>
+    void ForEach(Func&& func, EcsMask requiredMask = 0) const;
+
+    template <typename... Ts, typename Func>
+    void ForEachOfKind(eEntityKind kind, Func&& func) const;
+
+    EcsArchetype const&        GetArchetype(eEntityKind kind) const;
+    sSlabAllocatorStats const& GetChunkAllocatorStats() const;
+    size_t                     GetDirectoryBytesReserved() const; // entity records and their free list
+
+private:
+    struct sEntityRecord
+    {
+        int         m_row        = -1; // -1 while the record is on the free list
+        uint16_t    m_generation = 0;
+        eEntityKind m_kind       = eEntityKind::NUM;
+    };
+
+    template <typename... Ts, typename Func>
+    static void ForEachChunkInArchetype(EcsArchetype const& archetype, Func& func);
+
+    sEntityRecord const* ResolveRecord(EntityHandle handle) const;
+    void                 DestroyRow(EcsArchetype& archetype, int row);
+
+    EcsArchetype*              m_archetypes[ECS_ENTITY_KIND_NUM] = {};
+    std::vector<sEntityRecord> m_records;
+    std::vector<int>           m_freeRecords;       // stack of free record indices
+    size_t                     m_numMaxRecords = 0; // sum of the registered capacities; the directory never grows past it
+    SlabAllocator<sEcsChunk>   m_chunkAllocator;
+};
+
+//----------------------------------------------------------------------------------------------------
+template <typename T>
+T* EcsArchetype::GetColumn(int const chunkIndex) const
+{
+    return reinterpret_cast<T*>(m_chunks[chunkIndex]->m_bytes + m_columnOffsets[GetEcsColumnIndex<T>()]);
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename T>
+T* EcsArchetype::GetComponent(int const row) const
+{
+    return GetColumn<T>(row / m_rowsPerChunk) + row % m_rowsPerChunk;
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename T>
+T* EcsWorld::Get(EntityHandle const handle) const
+{
+    sEntityRecord const* record = ResolveRecord(handle);
+
+    if (record == nullptr) return nullptr;
+
+    EcsArchetype const* archetype = m_archetypes[static_cast<int>(record->m_kind)];
+
+    if (!archetype->HasComponents(MakeEcsMask(ECS_COMPONENT_ID<T>))) return nullptr;
+
+    return archetype->GetComponent<T>(record->m_row);
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename... Ts, typename Func>
+void EcsWorld::ForEachChunk(Func&& func, EcsMask const requiredMask) const
+{
+    EcsMask const mask = requiredMask | (EcsMask{0} | ... | MakeEcsMask(ECS_COMPONENT_ID<Ts>));
+
+    for (EcsArchetype const* archetype : m_archetypes)
+    {
+        if (archetype == nullptr || !archetype->HasComponents(mask)) continue;
+
+        ForEachChunkInArchetype<Ts...>(*archetype, func);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename... Ts, typename Func>
+void EcsWorld::ForEach(Func&& func, EcsMask const requiredMask) const
+{
+    ForEachChunk<Ts...>([&func](int const numRows, Ts*... columns)
+    {
+        for (int rowIndex = 0; rowIndex < numRows; ++rowIndex)
+        {
+            func(columns[rowIndex]...);
+        }
+    }, requiredMask);
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename... Ts, typename Func>
+void EcsWorld::ForEachOfKind(eEntityKind const kind, Func&& func) const
+{
+    auto forEachRow = [&func](int const numRows, Ts*... columns)
+    {
+        for (int rowIndex = 0; rowIndex < numRows; ++rowIndex)
+        {
+            func(columns[rowIndex]...);
+        }
+    };
+
+    ForEachChunkInArchetype<Ts...>(GetArchetype(kind), forEachRow);
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename... Ts, typename Func>
+void EcsWorld::ForEachChunkInArchetype(EcsArchetype const& archetype, Func& func)
+{
+    // Snapshot the count; rows spawned by the callback are picked up next pass
+    int const numEntities  = archetype.GetNumEntities();
+    int const rowsPerChunk = archetype.GetRowsPerChunk();
+
+    for (int chunkIndex = 0; chunkIndex * rowsPerChunk < numEntities; ++chunkIndex)
+    {
+        int const firstRow = chunkIndex * rowsPerChunk;
+        int const numRows  = numEntities - firstRow < rowsPerChunk ? numEntities - firstRow : rowsPerChunk;
+
+        func(numRows, archetype.GetColumn<Ts>(chunkIndex)...);
+    }
+}
@@ -0,0 +1,39 @@
+//----------------------------------------------------------------------------------------------------
+// EntityHandle.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+//----------------------------------------------------------------------------------------------------
+#include <cstdint>
+
+//----------------------------------------------------------------------------------------------------
+// 32-bit reference to an entity slot: the low 20 bits are the slot index, the high 12 bits are the
+// generation the slot had when the entity was spawned. The owning pool bumps a slot's generation on
+// Destroy, so a stale handle fails to resolve instead of pointing at whatever reused the slot.
+//
+struct EntityHandle
+{
+    static constexpr uint32_t INDEX_BITS      = 20;
+    static constexpr uint32_t GENERATION_BITS = 32 - INDEX_BITS;
+    static constexpr uint32_t INDEX_MASK      = (1u << INDEX_BITS) - 1u;
+    static constexpr uint32_t GENERATION_MASK = (1u << GENERATION_BITS) - 1u;
+    static constexpr uint32_t INVALID_DATA    = 0xFFFFFFFFu;
+
+    constexpr EntityHandle() = default;
+    constexpr EntityHandle(int const index, uint32_t const generation)
+        : m_data((static_cast<uint32_t>(index) & INDEX_MASK) | ((generation & GENERATION_MASK) << INDEX_BITS))
+    {
+    }
+
+    constexpr int      GetIndex() const { return static_cast<int>(m_data & INDEX_MASK); }
+    constexpr uint32_t GetGeneration() const { return m_data >> INDEX_BITS; }
+    constexpr bool     IsValid() const { return m_data != INVALID_DATA; }
+
+    constexpr bool operator==(EntityHandle const& other) const { return m_data == other.m_data; }
+    constexpr bool operator!=(EntityHandle const& other) const { return m_data != other.m_data; }
+
+    uint32_t m_data = INVALID_DATA;
+};
+
+static_assert(sizeof(EntityHandle) == 4, "EntityHandle must stay 32 bits so it packs tightly");
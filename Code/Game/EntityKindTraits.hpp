@@ -0,0 +1,119 @@
+//----------------------------------------------------------------------------------------------------
+// EntityKindTraits.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+//----------------------------------------------------------------------------------------------------
+#include "Game/EcsComponents.hpp"
+#include "Game/GameCommon.hpp"
+//----------------------------------------------------------------------------------------------------
+#include <cstdint>
+#include <utility>
+
+//----------------------------------------------------------------------------------------------------
+// Per-kind constants that used to be spread over the Spawn and collision functions as literals.
+// Everything here is known at compile time, so code that is templated on the kind folds them in.
+//
+struct sEntityKindTraits
+{
+    float m_physicsRadius  = 0.f;
+    float m_cosmeticRadius = 0.f;
+    int   m_health         = 0;
+    int   m_hitScore       = 0; // awarded to the player for every bullet hit
+    int   m_killScore      = 0; // awarded on top when the hit kills
+    int   m_hitDebrisNum   = 0;
+    int   m_deathDebrisNum = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+// Indexed by eEntityKind, like ECS_ARCHETYPE_MASKS.
+//
+constexpr sEntityKindTraits ENTITY_KIND_TRAITS[] =
+{
+    // physics radius            cosmetic radius              health                  hit  kill  debris: hit  death
+    {PLAYER_SHIP_PHYSICS_RADIUS, PLAYER_SHIP_COSMETIC_RADIUS, MAX_PLAYER_SHIP_HEALTH, 0,   0,    30,          30}, // PLAYER_SHIP
+    {BULLET_PHYSICS_RADIUS,      BULLET_COSMETIC_RADIUS,      1,                      0,   0,    0,           0},  // BULLET
+    {ASTEROID_PHYSICS_RADIUS,    ASTEROID_COSMETIC_RADIUS,    3,                      10,  100,  3,           12}, // ASTEROID
+    {BEETLE_PHYSICS_RADIUS,      BEETLE_COSMETIC_RADIUS,      3,                      20,  200,  3,           12}, // BEETLE
+    {WASP_PHYSICS_RADIUS,        WASP_COSMETIC_RADIUS,        3,                      50,  500,  3,           12}, // WASP
+};
+
+static_assert(sizeof(ENTITY_KIND_TRAITS) / sizeof(ENTITY_KIND_TRAITS[0]) == static_cast<size_t>(eEntityKind::NUM), "Every entity kind needs traits");
+
+template <eEntityKind Kind>
+constexpr sEntityKindTraits ENTITY_TRAITS = ENTITY_KIND_TRAITS[static_cast<int>(Kind)];
+
+//----------------------------------------------------------------------------------------------------
+// Which kinds a kind collides with, indexed [source][target]. Detection runs once per source over
+// all of its targets together; how a hit plays out is chosen by the target's kind when it is applied.
+//
+constexpr bool ENTITY_COLLISION_MATRIX[][static_cast<int>(eEntityKind::NUM)] =
+{
+    // SHIP  BULLET ASTEROID BEETLE WASP
+    {false, false, true,  true,  true},  // PLAYER_SHIP
+    {false, false, true,  true,  true},  // BULLET
+    {false, false, false, false, false}, // ASTEROID
+    {false, false, false, false, false}, // BEETLE
+    {false, false, false, false, false}, // WASP
+};
+
+static_assert(sizeof(ENTITY_COLLISION_MATRIX) / sizeof(ENTITY_COLLISION_MATRIX[0]) == static_cast<size_t>(eEntityKind::NUM), "The collision matrix is square");
+
+constexpr bool DoEntityKindsCollide(eEntityKind const source, eEntityKind const target)
+{
+    return ENTITY_COLLISION_MATRIX[static_cast<int>(source)][static_cast<int>(target)];
+}
+
+// One bit per target kind of a source's row, for testing broadphase candidates without a branch per kind
+constexpr uint32_t GetCollisionTargetMask(eEntityKind const source)
+{
+    uint32_t mask = 0;
+
+    for (int target = 0; target < static_cast<int>(eEntityKind::NUM); ++target)
+    {
+        if (DoEntityKindsCollide(source, static_cast<eEntityKind>(target))) mask |= 1u << target;
+    }
+
+    return mask;
+}
+
+constexpr float GetLargestPhysicsRadius()
+{
+    float largest = 0.f;
+
+    for (sEntityKindTraits const& traits : ENTITY_KIND_TRAITS)
+    {
+        if (traits.m_physicsRadius > largest) largest = traits.m_physicsRadius;
+    }
+
+    return largest;
+}
+
+static_assert(COLLISION_GRID_CELL_SIZE >= 2.f * GetLargestPhysicsRadius(), "A collider must never span more than two grid cells per axis");
+
+//----------------------------------------------------------------------------------------------------
+// Calls func.template operator()<Target>() for 'target' if Source collides with it, and does nothing
+// otherwise. Only the pairs the matrix allows are instantiated, so each call site gets one specialized
+// kernel per target kind with that pair's traits as constants.
+//
+template <eEntityKind Source, eEntityKind Target, typename Func>
+void DispatchCollisionTargetIfMatch(eEntityKind const target, Func& func)
+{
+    if constexpr (DoEntityKindsCollide(Source, Target))
+    {
+        if (target == Target) func.template operator()<Target>();
+    }
+}
+
+template <eEntityKind Source, typename Func, size_t... Targets>
+void DispatchCollisionTargetInSequence(eEntityKind const target, Func& func, std::index_sequence<Targets...>)
+{
+    (DispatchCollisionTargetIfMatch<Source, static_cast<eEntityKind>(Targets)>(target, func), ...);
+}
+
+template <eEntityKind Source, typename Func>
+void DispatchCollisionTarget(eEntityKind const target, Func&& func)
+{
+    DispatchCollisionTargetInSequence<Source>(target, func, std::make_index_sequence<static_cast<size_t>(eEntityKind::NUM)>());
+}
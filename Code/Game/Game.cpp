@@ -6,38 +6,121 @@
 //----------------------------------------------------------------------------------------------------
 #include "Game/Game.hpp"
 //----------------------------------------------------------------------------------------------------
+#include "Game/BoxWall.hpp"
+#include "Game/CollisionGrid.hpp"
+#include "Game/DebrisSystem.hpp"
+#include "Game/EcsSystems.hpp"
+#include "Game/EntityKindTraits.hpp"
+#include "Game/GameBenchmark.hpp"
 #include "Game/LevelData.hpp"
+#include "Game/MeshLibrary.hpp"
+#include "Game/RenderBatcher.hpp"
 #include "Game/ScoreBoardHandler.hpp"
+#include "Game/SweepAndPrune.hpp"
 #include "Game/UIHandler.hpp"
+#include "Game/WorkerPool.hpp"
 //----------------------------------------------------------------------------------------------------
 #include "Engine/Audio/AudioSystem.hpp"
 #include "Engine/Core/DevConsole.hpp"
 #include "Engine/Core/EngineCommon.hpp"
 #include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Engine/Core/StringUtils.hpp"
 #include "Engine/Input/InputSystem.hpp"
 #include "Engine/Math/MathUtils.hpp"
 #include "Engine/Math/RandomNumberGenerator.hpp"
 #include "Engine/Platform/Window.hpp"
 #include "Engine/Renderer/Renderer.hpp"
+//----------------------------------------------------------------------------------------------------
+#include <algorithm>
+#include <cfloat>
+#include <climits>
+#include <cstdint>
 
 #if defined ERROR
 #undef ERROR
 #endif
 
+//----------------------------------------------------------------------------------------------------
+// Indexed by eEntityKind
+static char const* const ENTITY_KIND_NAMES[] = {"PlayerShip", "Bullet", "Asteroid", "Beetle", "Wasp"};
+
+static_assert(sizeof(ENTITY_KIND_NAMES) / sizeof(ENTITY_KIND_NAMES[0]) == static_cast<size_t>(eEntityKind::NUM), "Every entity kind needs a name");
+
+//----------------------------------------------------------------------------------------------------
+// Every entity pool full plus a full box wall fits the world pass's stream from the start. Debris only
+// gets DEBRIS_RENDER_RESERVE_NUM particles' worth, since its whole pool would be far larger than a
+// frame ever uses; the stream grows past that on demand and then keeps the size. Summed in 64 bits,
+// since large valid capacities times verts per shape can pass INT_MAX.
+//
+static int GetWorldRenderReserveVerts(sPoolCapacities const& capacities, int const numBoxWallColumns)
+{
+    int64_t const numVerts = PLAYER_SHIP_VERTS_NUM +
+                             static_cast<int64_t>(capacities.m_bullets) * BULLET_VERTS_NUM +
+                             static_cast<int64_t>(capacities.m_asteroids) * ASTEROID_VERTS_NUM +
+                             static_cast<int64_t>(capacities.m_beetles) * BEETLE_VERTS_NUM +
+                             static_cast<int64_t>(capacities.m_wasps) * WASP_VERTS_NUM +
+                             static_cast<int64_t>(DEBRIS_RENDER_RESERVE_NUM) * DEBRIS_VERTS_NUM +
+                             static_cast<int64_t>(numBoxWallColumns) * BOX_WALL_ROW_NUM * BOX_VERTS_NUM;
+
+    return static_cast<int>(std::min<int64_t>(numVerts, INT_MAX));
+}
+
 //----------------------------------------------------------------------------------------------------
 Game::Game()
 {
     g_eventSystem->SubscribeEventCallbackFunction("setscale", Command_SetTimeScale);
+    g_eventSystem->SubscribeEventCallbackFunction("entitystats", Command_ShowEntityStats);
+    g_eventSystem->SubscribeEventCallbackFunction("broadphase", Command_SetBroadphase);
+    g_eventSystem->SubscribeEventCallbackFunction("collisionthreads", Command_SetCollisionThreads);
+    g_eventSystem->SubscribeEventCallbackFunction("sweep", Command_SweepFromPlayerShip);
+    g_eventSystem->SubscribeEventCallbackFunction("nearest", Command_ListNearestEnemies);
+    g_eventSystem->SubscribeEventCallbackFunction("benchmark", GameBenchmark::Command_RunEntityUpdateBenchmark);
+    g_eventSystem->SubscribeEventCallbackFunction("benchmarkcollision", GameBenchmark::Command_RunCollisionDispatchBenchmark);
+    g_eventSystem->SubscribeEventCallbackFunction("benchmarkkernels", GameBenchmark::Command_RunCollisionKernelBenchmark);
+    g_eventSystem->SubscribeEventCallbackFunction("benchmarkbroadphase", GameBenchmark::Command_RunBroadphaseBenchmark);
+    g_eventSystem->SubscribeEventCallbackFunction("benchmarkparallel", GameBenchmark::Command_RunParallelCollisionBenchmark);
+    g_eventSystem->SubscribeEventCallbackFunction("benchmarksweep", GameBenchmark::Command_RunSweepQueryBenchmark);
+    g_eventSystem->SubscribeEventCallbackFunction("benchmarkneighbors", GameBenchmark::Command_RunNearestNeighborBenchmark);
+    g_eventSystem->SubscribeEventCallbackFunction("benchmarkinstancing", GameBenchmark::Command_RunShapeInstancingBenchmark);
+    g_eventSystem->SubscribeEventCallbackFunction("benchmarkvertexgen", GameBenchmark::Command_RunParallelVertexBenchmark);
     g_eventSystem->FireEvent("help");
 
+    m_poolCapacities = LoadPoolCapacities(POOL_CONFIG_PATH);
+
     m_worldCamera          = new Camera();
     m_screenCamera         = new Camera();
     m_theUIHandler         = new UIHandler(this);
     m_theScoreBoardHandler = new ScoreBoardHandler();
     m_gameClock            = new Clock(Clock::GetSystemClock());
+    m_meshLibrary          = new MeshLibrary(ASTEROID_MESH_VARIANT_NUM, DEBRIS_MESH_VARIANT_NUM);
+    m_debrisSystem         = new DebrisSystem(m_poolCapacities.m_debris, m_meshLibrary);
+    m_renderBatcher        = new RenderBatcher();
+    m_entityRenderSystem   = new EntityRenderSystem(m_meshLibrary, *m_renderBatcher);
+    m_boxWall              = new BoxWall(m_meshLibrary, *m_renderBatcher);
+    m_renderBatcher->Reserve(GetWorldRenderReserveVerts(m_poolCapacities, m_boxWall->GetNumColumns()));
+    m_collisionGrid        = new CollisionGrid(Vec2(WORLD_SIZE_X, WORLD_SIZE_Y),
+                                               COLLISION_GRID_CELL_SIZE,
+                                               m_poolCapacities.m_asteroids + m_poolCapacities.m_beetles + m_poolCapacities.m_wasps);
+    m_sweepAndPrune        = new SweepAndPrune(m_poolCapacities.m_asteroids + m_poolCapacities.m_beetles + m_poolCapacities.m_wasps);
+
+    m_workerPool           = new WorkerPool(WorkerPool::GetDefaultNumThreads());
+
+    // Ship vs. enemies, then a fixed range of bullets per task, then ship vs. BoxWall; each bullet and
+    // the ship-vs-enemy check record at most one hit, the ship-vs-wall check at most its reach in boxes
+    int const numBulletTasks = (m_poolCapacities.m_bullets + COLLISION_BULLETS_PER_TASK - 1) / COLLISION_BULLETS_PER_TASK;
+
+    m_collisionCommandBuffers.resize(numBulletTasks + 2);
+    m_collisionCommandBuffers.front().Reserve(1);
+    m_collisionCommandBuffers.back().Reserve(BOX_WALL_ROW_NUM * 2);
+
+    for (int taskIndex = 1; taskIndex <= numBulletTasks; ++taskIndex)
+    {
+        m_collisionCommandBuffers[taskIndex].Reserve(COLLISION_BULLETS_PER_TASK);
+    }
 
+    RegisterArchetypes();
     SpawnPlayerShip();
-    SpawnBoxCluster();
+    m_boxWall->PushColumn();
     SpawnEnemiesForCurrentWave();
 
     Vec2 const bottomLeft     = Vec2::ZERO;
@@ -49,8 +132,12 @@ Game::Game()
     m_worldCamera->SetNormalizedViewport(AABB2::ZERO_TO_ONE);
     m_screenCamera->SetNormalizedViewport(AABB2::ZERO_TO_ONE);
 
-    SoundID const InGameBgm = g_audio->CreateOrGetSound(IN_GAME_BGM, eAudioSystemSoundDimension::Sound2D);
-    g_audio->StartSound(InGameBgm, true, 1.f, 0.f, 1.f, false);
+    m_inGameBgmSound = g_audio->CreateOrGetSound(IN_GAME_BGM, eAudioSystemSoundDimension::Sound2D);
+    m_entityHitSound = g_audio->CreateOrGetSound("Data/Audio/InGame_Entity_Hit.mp3", eAudioSystemSoundDimension::Sound2D);
+
+    g_audio->StartSound(m_inGameBgmSound, true, 1.f, 0.f, 1.f, false);
+
+    ReportPoolBudget();
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -62,56 +149,29 @@ Game::~Game()
     delete m_theScoreBoardHandler;
     m_theScoreBoardHandler = nullptr;
 
-    delete m_playerShip;
-    m_playerShip = nullptr;
+    delete m_collisionGrid;
+    m_collisionGrid = nullptr;
 
-    for (int beetleIndex = 0; beetleIndex < MAX_BEETLE_NUM; ++beetleIndex)
-    {
-        if (!m_beetle[beetleIndex]) continue;
+    delete m_sweepAndPrune;
+    m_sweepAndPrune = nullptr;
 
-        delete m_beetle[beetleIndex];
-        m_beetle[beetleIndex] = nullptr;
-    }
+    delete m_workerPool;
+    m_workerPool = nullptr;
 
-    for (int waspIndex = 0; waspIndex < MAX_WASP_NUM; ++waspIndex)
-    {
-        if (!m_wasp[waspIndex]) continue;
+    delete m_boxWall;
+    m_boxWall = nullptr;
 
-        delete m_wasp[waspIndex];
-        m_wasp[waspIndex] = nullptr;
-    }
-
-    for (int asteroidIndex = 0; asteroidIndex < MAX_ASTEROIDS_NUM; ++asteroidIndex)
-    {
-        if (!m_asteroids[asteroidIndex]) continue;
+    delete m_entityRenderSystem;
+    m_entityRenderSystem = nullptr;
 
-        delete m_asteroids[asteroidIndex];
-        m_asteroids[asteroidIndex] = nullptr;
-    }
+    delete m_renderBatcher;
+    m_renderBatcher = nullptr;
 
-    for (int bulletIndex = 0; bulletIndex < MAX_BULLETS_NUM; ++bulletIndex)
-    {
-        if (!m_bullets[bulletIndex]) continue;
+    delete m_debrisSystem;
+    m_debrisSystem = nullptr;
 
-        delete m_bullets[bulletIndex];
-        m_bullets[bulletIndex] = nullptr;
-    }
-
-    for (int debrisIndex = 0; debrisIndex < MAX_DEBRIS_NUM; ++debrisIndex)
-    {
-        if (!m_debris[debrisIndex]) continue;
-
-        delete m_debris[debrisIndex];
-        m_debris[debrisIndex] = nullptr;
-    }
-
-    for (int boxIndex = 0; boxIndex < MAX_BOX_NUM; ++boxIndex)
-    {
-        if (!m_boxes[boxIndex]) continue;
-
-        delete m_boxes[boxIndex];
-        m_boxes[boxIndex] = nullptr;
-    }
+    delete m_meshLibrary;
+    m_meshLibrary = nullptr;
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -156,7 +216,7 @@ void Game::Update()
         SpawnEnemiesForCurrentWave();
     }
 
-    if (m_playerShip->m_health == 0)
+    if (GetPlayerShipHealth()->m_health == 0)
     {
         m_timeSinceDeath += (float)deltaSeconds;
 
@@ -181,9 +241,14 @@ void Game::Update()
 }
 
 //----------------------------------------------------------------------------------------------------
+// Everything is queued on m_renderBatcher first and drawn by its Flush, which begins and ends the
+// two cameras itself.
+//
 void Game::Render()
 {
-    g_renderer->BeginCamera(*m_worldCamera);
+    m_renderBatcher->Begin();
+    m_renderBatcher->SetCamera(*m_worldCamera);
+    m_renderBatcher->SetCullBounds(GetWorldCameraBounds());
 
     if (!m_isAttractMode)
     {
@@ -191,22 +256,21 @@ void Game::Render()
         DebugRenderEntities();
     }
 
-    g_renderer->EndCamera(*m_worldCamera);
-
-    g_renderer->BeginCamera(*m_screenCamera);
+    m_renderBatcher->SetCamera(*m_screenCamera);
+    m_renderBatcher->SetCullBounds(AABB2(Vec2::ZERO, Vec2(SCREEN_SIZE_X, SCREEN_SIZE_Y)));
 
     if (!m_isAttractMode)
     {
-        m_theUIHandler->DrawInGameUI(m_playerShip->m_health - 1);
+        m_theUIHandler->DrawInGameUI(*m_renderBatcher, GetPlayerShipHealth()->m_health - 1);
     }
     else
     {
-        m_theUIHandler->DrawAttractModeUI();
+        m_theUIHandler->DrawAttractModeUI(*m_renderBatcher);
 
-        if (m_isPlayerNameInputMode) m_theUIHandler->DrawPlayerNameInput();
+        if (m_isPlayerNameInputMode) m_theUIHandler->DrawPlayerNameInput(*m_renderBatcher);
     }
 
-    g_renderer->EndCamera(*m_screenCamera);
+    m_renderBatcher->Flush(*m_workerPool);
 
     if (g_input->WasKeyJustPressed('U'))
     {
@@ -220,7 +284,7 @@ void Game::Render()
 
 
         m_theScoreBoardHandler->AddScore(scoreboard, currentSize, m_theUIHandler->GetPlayerShipName(),
-                                         m_playerShip->m_score);
+                                         GetPlayerScore());
 
         m_theScoreBoardHandler->SortScoreboard(scoreboard, currentSize);
         printf("Current size: %d\n", currentSize);
@@ -245,87 +309,112 @@ void Game::ResetData()
 }
 
 //----------------------------------------------------------------------------------------------------
-void Game::SpawnBullet(Vec2 const& position, const float orientationDegrees)
+// Puts the game back in the state a newly constructed Game starts in. Entities and debris are
+// cleared in bulk into their reserved storage, and cameras, handlers, the clock and loaded sounds
+// are kept, so a restart allocates nothing and the BGM keeps playing. The high score and the debug
+// render toggle survive, as they describe the session rather than the run. Attract mode never runs
+// collision, so the broadphase is rebuilt here for queries to see the new run's enemies only.
+//
+void Game::Reset()
 {
-    for (int bulletIndex = 0; bulletIndex < MAX_BULLETS_NUM; bulletIndex++)
+    m_world.Clear();
+    m_debrisSystem->Clear();
+    m_boxWall->Clear();
+
+    // Building both empty also drops the sweep-and-prune's order hints from the last run
+    m_collisionGrid->Clear();
+    m_collisionGrid->Build();
+    m_sweepAndPrune->Clear();
+    m_sweepAndPrune->Build();
+
+    for (CollisionCommandBuffer& commands : m_collisionCommandBuffers)
     {
-        if (m_bullets[bulletIndex]) continue;
+        commands.Clear();
+    }
 
-        m_bullets[bulletIndex] = new Bullet(position, orientationDegrees);
+    m_theUIHandler->Reset();
+    m_gameClock->Reset();
+    m_gameClock->SetTimeScale(1.f);
 
+    m_playerShipHandle      = EntityHandle();
+    m_currentWave           = 0;
+    m_timeSinceDeath        = 0.f;
+    m_playerShipHealth      = MAX_PLAYER_SHIP_HEALTH;
+    m_isAttractMode         = true;
+    m_isPlayerNameInputMode = false;
+    m_isHighScoreboardMode  = false;
+    m_shakeIntensity        = 5.f;
+    m_shakeDuration         = 20.f;
+    m_baseCameraPos         = Vec2::ZERO;
+    m_cameraShakeOffset     = Vec2::ZERO;
+
+    m_worldCamera->SetOrthoGraphicView(Vec2::ZERO, Vec2(WORLD_SIZE_X, WORLD_SIZE_Y));
+
+    SpawnPlayerShip();
+    m_boxWall->PushColumn();
+    SpawnEnemiesForCurrentWave();
+    RebuildBroadphase();
+}
+
+//----------------------------------------------------------------------------------------------------
+void Game::SpawnBullet(Vec2 const& position, const float orientationDegrees)
+{
+    EntityHandle const handle = m_world.Spawn(eEntityKind::BULLET);
+
+    if (!handle.IsValid())
+    {
+        ERROR_RECOVERABLE("Cannot spawn a new bullet; all slots are full")
         return;
     }
 
-    ERROR_RECOVERABLE("Cannot spawn a new asteroid; all slots are full")
+    *m_world.Get<sTransform>(handle) = {position, orientationDegrees};
+    *m_world.Get<sVelocity>(handle)  = {Vec2::MakeFromPolarDegrees(orientationDegrees, BULLET_SPEED)};
+    *m_world.Get<sCollider>(handle)  = {ENTITY_TRAITS<eEntityKind::BULLET>.m_physicsRadius, ENTITY_TRAITS<eEntityKind::BULLET>.m_cosmeticRadius};
+    *m_world.Get<sMeshRef>(handle)   = {eMeshId::BULLET, 0, 1.f, Rgba8(255, 255, 0, 255)};
+}
+
+//----------------------------------------------------------------------------------------------------
+EntityHandle Game::GetPlayerShipHandle() const
+{
+    return m_playerShipHandle;
 }
 
 //----------------------------------------------------------------------------------------------------
-PlayerShip* Game::GetPlayerShip() const
+int Game::GetPlayerScore() const
 {
-    return m_playerShip;
+    sPlayerControl const* control = GetPlayerShipControl();
+
+    return control != nullptr ? control->m_score : 0;
 }
 
 //----------------------------------------------------------------------------------------------------
 void Game::MarkAllEntityAsDeadAndGarbage()
 {
-    for (int beetleIndex = 0; beetleIndex < MAX_BEETLE_NUM; ++beetleIndex)
+    m_world.ForEach<sTransform, sHealth, sMeshRef>([this](sTransform const& transform, sHealth& health, sMeshRef const& meshRef)
     {
-        if (m_beetle[beetleIndex] && !m_beetle[beetleIndex]->IsDead())
-        {
-            m_beetle[beetleIndex]->MarkAsDead();
-            m_beetle[beetleIndex]->MarkAsGarbage();
-
-            // #TODO: FIX
-            SpawnDebrisCluster(m_beetle[beetleIndex]->GetPosition(),
-                               Vec2(0.2f, 0.2f),
-                               30,
-                               ENTITY_DEAD_DEBRIS_RADIUS,
-                               m_beetle[beetleIndex]->GetColor());
-        }
-    }
+        if (health.m_isDead) return;
 
-    for (int waspIndex = 0; waspIndex < MAX_WASP_NUM; ++waspIndex)
-    {
-        if (m_wasp[waspIndex] && !m_wasp[waspIndex]->IsDead())
-        {
-            m_wasp[waspIndex]->MarkAsDead();
-            m_wasp[waspIndex]->MarkAsGarbage();
-            SpawnDebrisCluster(m_wasp[waspIndex]->GetPosition(),
-                               Vec2(0.2f, 0.2f),
-                               30,
-                               ENTITY_DEAD_DEBRIS_RADIUS,
-                               m_wasp[waspIndex]->GetColor());
-        }
-    }
+        health.m_isDead    = true;
+        health.m_isGarbage = true;
 
-    for (int asteroidIndex = 0; asteroidIndex < MAX_ASTEROIDS_NUM; ++asteroidIndex)
-    {
-        if (m_asteroids[asteroidIndex] && !m_asteroids[asteroidIndex]->IsDead())
-        {
-            m_asteroids[asteroidIndex]->MarkAsDead();
-            m_asteroids[asteroidIndex]->MarkAsGarbage();
-
-            SpawnDebrisCluster(m_asteroids[asteroidIndex]->GetPosition(),
-                               Vec2(0.2f, 0.2f),
-                               30,
-                               ENTITY_DEAD_DEBRIS_RADIUS,
-                               m_asteroids[asteroidIndex]->GetColor());
-        }
-    }
+        // #TODO: FIX
+        SpawnDebrisCluster(transform.m_position,
+                           Vec2(0.2f, 0.2f),
+                           30,
+                           ENTITY_DEAD_DEBRIS_RADIUS,
+                           meshRef.m_color);
+    }, MakeEcsMask(eEcsComponent::TAG_ENEMY));
 
-    for (int boxIndex = 0; boxIndex < MAX_BOX_NUM; ++boxIndex)
+    m_boxWall->ForEachBox([this](sBoxWallCell const& cell)
     {
-        if (m_boxes[boxIndex] && !m_boxes[boxIndex]->IsDead())
-        {
-            m_boxes[boxIndex]->MarkAsDead();
-            m_boxes[boxIndex]->MarkAsGarbage();
-            SpawnDebrisCluster(m_boxes[boxIndex]->GetBoxCollider().GetCenter(),
-                               Vec2(0.2f, 0.2f),
-                               30,
-                               ENTITY_DEAD_DEBRIS_RADIUS,
-                               m_boxes[boxIndex]->GetColor());
-        }
-    }
+        SpawnDebrisCluster(m_boxWall->GetCellBounds(cell).GetCenter(),
+                           Vec2(0.2f, 0.2f),
+                           30,
+                           ENTITY_DEAD_DEBRIS_RADIUS,
+                           BOX_COLOR);
+    });
+
+    m_boxWall->Clear();
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -342,7 +431,7 @@ void Game::SetPlayerNameInputMode(const bool isPlayerNameInputMode)
 
 void Game::SetPlayerShipIsReadyToSpawnBullet(const bool isReadyToSpawnBullet) const
 {
-    m_playerShip->IsReadyToSpawnBullet(isReadyToSpawnBullet);
+    GetPlayerShipControl()->m_isReadyToSpawnBullet = isReadyToSpawnBullet;
     printf("SetPlayerShipIsReadyToSpawnBullet: %hhd\n", isReadyToSpawnBullet);
 }
 
@@ -361,6 +450,12 @@ int Game::GetHighScore() const
     return m_highScore;
 }
 
+//----------------------------------------------------------------------------------------------------
+sRenderBatcherStats const& Game::GetLastFrameRenderStats() const
+{
+    return m_renderBatcher->GetLastFrameStats();
+}
+
 //----------------------------------------------------------------------------------------------------
 STATIC bool Game::Command_SetTimeScale(EventArgs& args)
 {
@@ -378,175 +473,341 @@ STATIC bool Game::Command_SetTimeScale(EventArgs& args)
 }
 
 //----------------------------------------------------------------------------------------------------
-void Game::SpawnPlayerShip()
+STATIC bool Game::Command_ShowEntityStats(EventArgs& args)
 {
-    m_playerShip = new PlayerShip(Vec2(20.f, WORLD_CENTER_Y), 0.f, m_playerShipHealth, false);
+    UNUSED(args)
+
+    g_game->ReportPoolBudget();
+
+    return true;
 }
 
 //----------------------------------------------------------------------------------------------------
-void Game::SpawnBeetle(Vec2 const& position)
+STATIC bool Game::Command_SetBroadphase(EventArgs& args)
 {
-    for (int beetleIndex = 0; beetleIndex < MAX_BEETLE_NUM; beetleIndex++)
+    String const type = args.GetValue("type", String());
+
+    for (int broadphaseIndex = 0; broadphaseIndex < static_cast<int>(eBroadphase::NUM); ++broadphaseIndex)
     {
-        if (m_beetle[beetleIndex]) continue;
+        if (type != BROADPHASE_NAMES[broadphaseIndex]) continue;
 
-        m_beetle[beetleIndex] = new Beetle(position, 0.f);
+        // Rebuilt right away, so queries before the next collision pass see the live enemies rather
+        // than whatever the structure held when it was last active
+        g_game->m_broadphase = static_cast<eBroadphase>(broadphaseIndex);
+        g_game->RebuildBroadphase();
+        g_devConsole->AddLine(DevConsole::INFO_MINOR, Stringf("Broadphase set to %s", BROADPHASE_NAMES[broadphaseIndex]));
 
-        return;
+        return true;
     }
+
+    g_devConsole->AddLine(DevConsole::ERROR, "Usage: broadphase type=grid|sap");
+
+    return false;
 }
 
 //----------------------------------------------------------------------------------------------------
-void Game::SpawnWasp(Vec2 const& position)
+STATIC bool Game::Command_SetCollisionThreads(EventArgs& args)
 {
-    for (int waspIndex = 0; waspIndex < MAX_WASP_NUM; waspIndex++)
+    int const numThreads = args.GetValue("count", 0);
+
+    if (numThreads <= 0)
     {
-        if (m_wasp[waspIndex]) continue;
+        g_devConsole->AddLine(DevConsole::ERROR, "Usage: collisionthreads count=PositiveInt");
+        return false;
+    }
 
-        m_wasp[waspIndex] = new Wasp(position, 0.f);
+    delete g_game->m_workerPool;
+    g_game->m_workerPool = new WorkerPool(numThreads);
 
-        return;
-    }
+    g_devConsole->AddLine(DevConsole::INFO_MINOR, Stringf("Collision detection now runs on %d threads", numThreads));
+
+    return true;
 }
 
 //----------------------------------------------------------------------------------------------------
-void Game::SpawnAsteroid(Vec2 const& position)
+// Lists what a sweep straight ahead of the player ship would touch, nearest first.
+//
+STATIC bool Game::Command_SweepFromPlayerShip(EventArgs& args)
 {
-    for (int asteroidIndex = 0; asteroidIndex < MAX_ASTEROIDS_NUM; asteroidIndex++)
+    float const radius    = args.GetValue("radius", 0.f);
+    float const maxLength = args.GetValue("length", WORLD_SIZE_X);
+
+    sTransform const* playerShipTransform = g_game->m_world.Get<sTransform>(g_game->m_playerShipHandle);
+
+    if (radius < 0.f || maxLength <= 0.f || playerShipTransform == nullptr)
     {
-        if (m_asteroids[asteroidIndex]) continue;
+        g_devConsole->AddLine(DevConsole::ERROR, "Usage: sweep radius=NonNegativeFloat length=PositiveFloat (needs a player ship)");
+        return false;
+    }
 
-        m_asteroids[asteroidIndex] = new Asteroid(position, 0.f);
+    sSweepQuery query;
+    query.m_start     = playerShipTransform->m_position;
+    query.m_direction = Vec2::MakeFromPolarDegrees(playerShipTransform->m_orientationDegrees);
+    query.m_maxLength = maxLength;
+    query.m_radius    = radius;
 
-        return;
+    std::vector<sSweepHit> hits;
+    g_game->SweepDiscAllHits(query, hits);
+
+    g_devConsole->AddLine(DevConsole::INFO_MAJOR, Stringf("Sweep radius %.2f over %.1f: %d hits", radius, maxLength, static_cast<int>(hits.size())));
+
+    for (sSweepHit const& hit : hits)
+    {
+        g_devConsole->AddLine(DevConsole::INFO_MINOR,
+                              Stringf("  %7.2f  %-10s at (%.1f, %.1f)  normal (%.2f, %.2f)",
+                                      hit.m_distance,
+                                      hit.m_kind == eSweepHitKind::BOX ? "Box" : ENTITY_KIND_NAMES[static_cast<int>(hit.m_entityKind)],
+                                      hit.m_position.x, hit.m_position.y,
+                                      hit.m_normal.x, hit.m_normal.y));
     }
 
-    ERROR_RECOVERABLE("Cannot spawn a new bullet; all slots are full")
+    return true;
 }
 
 //----------------------------------------------------------------------------------------------------
-void Game::SpawnDebris(Vec2 const& position, Vec2 const& velocity, float radius, Rgba8 color)
+STATIC bool Game::Command_ListNearestEnemies(EventArgs& args)
 {
-    for (int debrisIndex = 0; debrisIndex < MAX_DEBRIS_NUM; debrisIndex++)
+    constexpr int maxCount = 32;
+
+    int const   count       = args.GetValue("count", 5);
+    float const maxDistance = args.GetValue("radius", FLT_MAX);
+
+    sTransform const* playerShipTransform = g_game->m_world.Get<sTransform>(g_game->m_playerShipHandle);
+
+    if (count <= 0 || count > maxCount || maxDistance < 0.f || playerShipTransform == nullptr)
     {
-        if (m_debris[debrisIndex]) continue;
+        g_devConsole->AddLine(DevConsole::ERROR, Stringf("Usage: nearest count=[1, %d] radius=NonNegativeFloat (needs a player ship)", maxCount));
+        return false;
+    }
 
-        m_debris[debrisIndex] = new Debris(position, velocity, radius, color);
+    sBroadphaseNeighbor neighbors[maxCount];
+    int const           numNeighbors = g_game->FindNearestEnemies(playerShipTransform->m_position, maxDistance, count, neighbors);
 
-        return;
+    g_devConsole->AddLine(DevConsole::INFO_MAJOR, Stringf("%d nearest enemies to the player ship:", numNeighbors));
+
+    for (int neighborIndex = 0; neighborIndex < numNeighbors; ++neighborIndex)
+    {
+        sBroadphaseNeighbor const& neighbor = neighbors[neighborIndex];
+
+        g_devConsole->AddLine(DevConsole::INFO_MINOR,
+                              Stringf("  %7.2f  %-10s at (%.1f, %.1f)",
+                                      neighbor.m_distance,
+                                      ENTITY_KIND_NAMES[static_cast<int>(neighbor.m_kind)],
+                                      neighbor.m_center.x, neighbor.m_center.y));
     }
+
+    return true;
 }
 
 //----------------------------------------------------------------------------------------------------
-void Game::SpawnDebrisCluster(Vec2 const& position, Vec2 const& velocity, int numDebris, float radius, Rgba8 color)
+void Game::RegisterArchetypes()
 {
-    for (int debrisIndex = 0; debrisIndex < numDebris; debrisIndex++)
-    {
-        float randomRadius = g_rng->RollRandomFloatInRange(1.f, 5.f) * radius;
-        float randomX      = g_rng->RollRandomFloatInRange(0.f, 360.f);
-        float randomY      = g_rng->RollRandomFloatInRange(0.f, 360.f);
+    int const capacities[] = {1,
+                              m_poolCapacities.m_bullets,
+                              m_poolCapacities.m_asteroids,
+                              m_poolCapacities.m_beetles,
+                              m_poolCapacities.m_wasps};
 
-        SpawnDebris(position, Vec2(velocity.x * randomX, velocity.y * randomY), randomRadius, color);
+    for (int kindIndex = 0; kindIndex < static_cast<int>(eEntityKind::NUM); ++kindIndex)
+    {
+        m_world.RegisterArchetype(static_cast<eEntityKind>(kindIndex), ECS_ARCHETYPE_MASKS[kindIndex], capacities[kindIndex]);
     }
 }
 
-void Game::SpawnBox(Vec2 const& position)
+//----------------------------------------------------------------------------------------------------
+// Bytes reserved up front by every pool, with live and peak usage, so capacities in POOL_CONFIG_PATH
+// can be tuned per machine. Printed once at startup and on 'entitystats'.
+//
+void Game::ReportPoolBudget() const
 {
-    for (int boxIndex = 0; boxIndex < MAX_BOX_NUM; boxIndex++)
-    {
-        if (m_boxes[boxIndex]) continue;
-
-        m_boxes[boxIndex] = new Box(position, 0.f);
+    size_t totalBytes = 0;
+
+    g_devConsole->AddLine(DevConsole::INFO_MAJOR, Stringf("Pool budget (%s)", POOL_CONFIG_PATH));
+
+    for (int kindIndex = 0; kindIndex < static_cast<int>(eEntityKind::NUM); ++kindIndex)
+    {
+        EcsArchetype const&       archetype = m_world.GetArchetype(static_cast<eEntityKind>(kindIndex));
+        sEcsArchetypeStats const& stats     = archetype.GetStats();
+
+        totalBytes += archetype.GetNumBytesReserved();
+
+        g_devConsole->AddLine(DevConsole::INFO_MINOR,
+                              Stringf("%-10s %9.1f KB | live %6d/%-6d peak %6d failed %4d | chunks %3d/%-3d rows/chunk %4d",
+                                      ENTITY_KIND_NAMES[kindIndex],
+                                      static_cast<double>(archetype.GetNumBytesReserved()) / 1024.0,
+                                      stats.m_numLive, archetype.GetCapacity(),
+                                      stats.m_highWaterMark,
+                                      stats.m_numFailedSpawns,
+                                      archetype.GetNumChunks(), archetype.GetNumChunksForCapacity(),
+                                      archetype.GetRowsPerChunk()));
+    }
+
+    sSlabAllocatorStats const& chunkStats = m_world.GetChunkAllocatorStats();
+
+    g_devConsole->AddLine(DevConsole::INFO_MINOR,
+                          Stringf("Chunks     %5d/%-5d in use (%d KB each) growths %d",
+                                  chunkStats.m_numBlocksInUse, chunkStats.m_numBlocksReserved,
+                                  ECS_CHUNK_BYTES / 1024,
+                                  chunkStats.m_numGrowthsAfterReserve));
+
+    totalBytes += m_world.GetDirectoryBytesReserved();
+    totalBytes += m_debrisSystem->GetNumBytesReserved();
+    totalBytes += m_renderBatcher->GetNumBytesReserved();
+    totalBytes += m_collisionGrid->GetNumBytesReserved();
+    totalBytes += m_sweepAndPrune->GetNumBytesReserved();
+
+    size_t commandBytes = 0;
+    int    numHits      = 0;
+
+    for (CollisionCommandBuffer const& commands : m_collisionCommandBuffers)
+    {
+        commandBytes += commands.GetNumBytesReserved();
+        numHits      += static_cast<int>(commands.GetHits().size());
+    }
+
+    totalBytes += commandBytes;
+    totalBytes += m_boxWall->GetNumBytesReserved();
+
+    g_devConsole->AddLine(DevConsole::INFO_MINOR,
+                          Stringf("Directory  %9.1f KB",
+                                  static_cast<double>(m_world.GetDirectoryBytesReserved()) / 1024.0));
+    g_devConsole->AddLine(DevConsole::INFO_MINOR,
+                          Stringf("Debris     %9.1f KB | live %6d/%-6d peak %6d",
+                                  static_cast<double>(m_debrisSystem->GetNumBytesReserved()) / 1024.0,
+                                  m_debrisSystem->GetNumLive(), m_debrisSystem->GetCapacity(),
+                                  m_debrisSystem->GetHighWaterMark()));
+    sRenderBatcherStats const& renderStats = m_renderBatcher->GetLastFrameStats();
+
+    g_devConsole->AddLine(DevConsole::INFO_MINOR,
+                          Stringf("RenderVerts%9.1f KB | %d draws of %d batches, %d verts, %d cameras, state sets %d (%d redundant skipped), %d instances in %d runs, %d culled last frame, growths %d",
+                                  static_cast<double>(m_renderBatcher->GetNumBytesReserved()) / 1024.0,
+                                  renderStats.m_numDrawCalls,
+                                  renderStats.m_numBatches,
+                                  renderStats.m_numVerts,
+                                  renderStats.m_numCameraChanges,
+                                  renderStats.m_numStateSets,
+                                  renderStats.m_numRedundantStateSets,
+                                  renderStats.m_numInstances,
+                                  renderStats.m_numInstanceRuns,
+                                  renderStats.m_numCulled,
+                                  renderStats.m_numGrowths));
+    g_devConsole->AddLine(DevConsole::INFO_MINOR,
+                          Stringf("BoxWall    %9.1f KB | boxes %6d in %d columns x %d rows",
+                                  static_cast<double>(m_boxWall->GetNumBytesReserved()) / 1024.0,
+                                  m_boxWall->GetNumBoxes(), m_boxWall->GetNumColumns(), BOX_WALL_ROW_NUM));
+    g_devConsole->AddLine(DevConsole::INFO_MINOR,
+                          Stringf("Grid       %9.1f KB | %dx%d cells entries %6d candidates last frame %d",
+                                  static_cast<double>(m_collisionGrid->GetNumBytesReserved()) / 1024.0,
+                                  m_collisionGrid->GetNumCellsX(), m_collisionGrid->GetNumCellsY(),
+                                  m_collisionGrid->GetNumEntries(),
+                                  m_collisionGrid->GetNumCandidatesVisited()));
+    g_devConsole->AddLine(DevConsole::INFO_MINOR,
+                          Stringf("SAP        %9.1f KB | entries %6d candidates last frame %d sort shifts %d",
+                                  static_cast<double>(m_sweepAndPrune->GetNumBytesReserved()) / 1024.0,
+                                  m_sweepAndPrune->GetNumEntries(),
+                                  m_sweepAndPrune->GetNumCandidatesVisited(),
+                                  m_sweepAndPrune->GetNumSortShifts()));
+    g_devConsole->AddLine(DevConsole::INFO_MINOR,
+                          Stringf("HitBuffers %9.1f KB | %d buffers, %d hits last frame, detected on %d threads",
+                                  static_cast<double>(commandBytes) / 1024.0,
+                                  static_cast<int>(m_collisionCommandBuffers.size()),
+                                  numHits,
+                                  m_workerPool->GetNumThreads()));
+    g_devConsole->AddLine(DevConsole::INFO_MINOR,
+                          Stringf("Broadphase %s (only the active one is rebuilt)", BROADPHASE_NAMES[static_cast<int>(m_broadphase)]));
+    g_devConsole->AddLine(DevConsole::INFO_MAJOR,
+                          Stringf("Total      %9.1f KB reserved", static_cast<double>(totalBytes) / 1024.0));
+}
 
-        return;
-    }
+//----------------------------------------------------------------------------------------------------
+void Game::SpawnPlayerShip()
+{
+    // Respawning replaces the previous ship; destroying it also invalidates any handles still held to it
+    m_world.Destroy(m_playerShipHandle);
+    m_playerShipHandle = m_world.Spawn(eEntityKind::PLAYER_SHIP);
+
+    *m_world.Get<sTransform>(m_playerShipHandle) = {Vec2(20.f, WORLD_CENTER_Y), 0.f};
+    *m_world.Get<sHealth>(m_playerShipHandle)    = {m_playerShipHealth, false, false};
+    *m_world.Get<sCollider>(m_playerShipHandle)  = {ENTITY_TRAITS<eEntityKind::PLAYER_SHIP>.m_physicsRadius, ENTITY_TRAITS<eEntityKind::PLAYER_SHIP>.m_cosmeticRadius};
+    *m_world.Get<sMeshRef>(m_playerShipHandle)   = {eMeshId::PLAYER_SHIP, 0, 1.f, PLAYER_SHIP_COLOR};
 }
 
-void Game::SpawnBoxCluster()
+//----------------------------------------------------------------------------------------------------
+void Game::SpawnBeetle(Vec2 const& position)
 {
-    float yPosUp   = WORLD_SIZE_Y - BOX_SIDE_LENGTH * 1.1f;
-    float yPosDown = BOX_SIDE_LENGTH * 0.1f;
+    constexpr sEntityKindTraits traits = ENTITY_TRAITS<eEntityKind::BEETLE>;
 
-    int boxNumUp   = g_rng->RollRandomIntInRange(1, 10);
-    int boxNumDown = g_rng->RollRandomIntInRange(1, 10);
+    EntityHandle const handle = m_world.Spawn(eEntityKind::BEETLE);
 
-    for (int i = 0; i < boxNumUp; ++i)
-    {
-        SpawnBox(Vec2(WORLD_SIZE_X, yPosUp));
-        yPosUp -= BOX_SIDE_LENGTH * 1.1f;
-    }
+    if (!handle.IsValid()) return;
 
-    for (int i = 0; i < boxNumDown; ++i)
-    {
-        SpawnBox(Vec2(WORLD_SIZE_X, yPosDown));
-        yPosDown += BOX_SIDE_LENGTH * 1.1f;
-    }
+    m_world.Get<sTransform>(handle)->m_position = position;
+    m_world.Get<sHealth>(handle)->m_health      = traits.m_health;
+    *m_world.Get<sCollider>(handle)             = {traits.m_physicsRadius, traits.m_cosmeticRadius};
+    *m_world.Get<sMeshRef>(handle)              = {eMeshId::BEETLE, 0, 1.f, BEETLE_COLOR};
+    *m_world.Get<sChase>(handle)                = {m_playerShipHandle, eChaseStyle::STEER};
 }
 
-
 //----------------------------------------------------------------------------------------------------
-void Game::UpdateEntities(float deltaSeconds)
+void Game::SpawnWasp(Vec2 const& position)
 {
-    if (m_isAttractMode) return;
+    constexpr sEntityKindTraits traits = ENTITY_TRAITS<eEntityKind::WASP>;
 
-    HandleEntityIsOffScreen();
-    HandleEntityCollision();
+    EntityHandle const handle = m_world.Spawn(eEntityKind::WASP);
 
-    for (int asteroidIndex = 0; asteroidIndex < MAX_ASTEROIDS_NUM; asteroidIndex++)
-    {
-        if (!m_asteroids[asteroidIndex]) continue;
+    if (!handle.IsValid()) return;
 
-        m_asteroids[asteroidIndex]->Update(deltaSeconds);
-    }
-
-    for (int bulletIndex = 0; bulletIndex < MAX_BULLETS_NUM; bulletIndex++)
-    {
-        if (!m_bullets[bulletIndex]) continue;
-
-        m_bullets[bulletIndex]->Update(deltaSeconds);
-    }
+    m_world.Get<sTransform>(handle)->m_position = position;
+    m_world.Get<sHealth>(handle)->m_health      = traits.m_health;
+    *m_world.Get<sCollider>(handle)             = {traits.m_physicsRadius, traits.m_cosmeticRadius};
+    *m_world.Get<sMeshRef>(handle)              = {eMeshId::WASP, 0, 1.f, WASP_COLOR};
+    *m_world.Get<sChase>(handle)                = {m_playerShipHandle, eChaseStyle::ACCELERATE};
+}
 
-    for (int debrisIndex = 0; debrisIndex < MAX_DEBRIS_NUM; debrisIndex++)
-    {
-        if (!m_debris[debrisIndex]) continue;
+//----------------------------------------------------------------------------------------------------
+void Game::SpawnAsteroid(Vec2 const& position)
+{
+    constexpr sEntityKindTraits traits = ENTITY_TRAITS<eEntityKind::ASTEROID>;
 
-        m_debris[debrisIndex]->Update(deltaSeconds);
-    }
+    EntityHandle const handle = m_world.Spawn(eEntityKind::ASTEROID);
 
-    for (int beetleIndex = 0; beetleIndex < MAX_BEETLE_NUM; beetleIndex++)
+    if (!handle.IsValid())
     {
-        if (!m_beetle[beetleIndex]) continue;
-
-        m_beetle[beetleIndex]->Update(deltaSeconds);
+        ERROR_RECOVERABLE("Cannot spawn a new asteroid; all slots are full")
+        return;
     }
 
-    for (int waspIndex = 0; waspIndex < MAX_WASP_NUM; waspIndex++)
-    {
-        if (!m_wasp[waspIndex]) continue;
+    float const angularVelocity = g_rng->RollRandomFloatInRange(-200.f, 200.f);
+    float const rangeX          = g_rng->RollRandomFloatInRange(-ASTEROID_SPEED, ASTEROID_SPEED);
+    float const rangeY          = ASTEROID_SPEED - rangeX;
+    int const   variantIndex    = g_rng->RollRandomIntInRange(0, ASTEROID_MESH_VARIANT_NUM - 1);
 
-        m_wasp[waspIndex]->Update(deltaSeconds);
-    }
+    m_world.Get<sTransform>(handle)->m_position = position;
+    *m_world.Get<sVelocity>(handle)             = {Vec2(rangeX, rangeY)};
+    *m_world.Get<sSpin>(handle)                 = {angularVelocity};
+    m_world.Get<sHealth>(handle)->m_health      = traits.m_health;
+    *m_world.Get<sCollider>(handle)             = {traits.m_physicsRadius, traits.m_cosmeticRadius};
+    *m_world.Get<sMeshRef>(handle)              = {eMeshId::ASTEROID, static_cast<uint8_t>(variantIndex), traits.m_cosmeticRadius, ASTEROID_COLOR};
+}
 
-    for (int boxIndex = 0; boxIndex < MAX_BOX_NUM; boxIndex++)
-    {
-        if (!m_boxes[boxIndex]) continue;
+//----------------------------------------------------------------------------------------------------
+void Game::SpawnDebrisCluster(Vec2 const& position, Vec2 const& velocity, int numDebris, float radius, Rgba8 color)
+{
+    m_debrisSystem->SpawnDebrisCluster(position, velocity, numDebris, radius, color);
+}
 
-        m_boxes[boxIndex]->Update(deltaSeconds);
-    }
+//----------------------------------------------------------------------------------------------------
+void Game::UpdateEntities(float deltaSeconds)
+{
+    if (m_isAttractMode) return;
 
-    m_accumulatedTime += deltaSeconds;
+    HandleEntityCollision(deltaSeconds);
 
-    if (m_accumulatedTime >= 1.0f)
-    {
-        SpawnBoxCluster();
+    m_systems.Update(m_world, deltaSeconds);
 
-        m_accumulatedTime = 0.0f;
-    }
+    m_debrisSystem->Update(deltaSeconds);
 
-    if (m_playerShip)
-    {
-        m_playerShip->Update(deltaSeconds);
-    }
+    m_boxWall->Update(deltaSeconds);
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -569,12 +830,12 @@ void Game::UpdateFromKeyBoard()
 
     if (!g_input->WasKeyJustPressed(KEYCODE_ENTER) &&
         g_input->IsKeyDown(KEYCODE_ENTER))
-        m_playerShip->IsReadyToSpawnBullet(true);
+        GetPlayerShipControl()->m_isReadyToSpawnBullet = true;
 
     if (g_input->WasKeyJustPressed('I')) SpawnAsteroid(GetOffScreenPosition(ASTEROID_COSMETIC_RADIUS));
 
     if (g_input->WasKeyJustPressed('N') &&
-        m_playerShip->IsDead() &&
+        GetPlayerShipHealth()->m_isDead &&
         m_playerShipHealth != 0)
     {
         SpawnPlayerShip();
@@ -599,12 +860,12 @@ void Game::UpdateFromController()
 
     if (!controller.WasButtonJustPressed(XBOX_BUTTON_START) &&
         controller.IsButtonDown(XBOX_BUTTON_START))
-        m_playerShip->IsReadyToSpawnBullet(true);
+        GetPlayerShipControl()->m_isReadyToSpawnBullet = true;
 
     if (controller.WasButtonJustPressed(XBOX_BUTTON_RTHUMB)) SpawnAsteroid(GetOffScreenPosition(ASTEROID_COSMETIC_RADIUS));
 
     if (controller.WasButtonJustPressed(XBOX_BUTTON_START) &&
-        m_playerShip->IsDead() &&
+        GetPlayerShipHealth()->m_isDead &&
         m_playerShipHealth != 0)
         SpawnPlayerShip();
 }
@@ -612,503 +873,657 @@ void Game::UpdateFromController()
 //----------------------------------------------------------------------------------------------------
 void Game::RenderEntities() const
 {
-    if (m_playerShip) m_playerShip->Render();
+    m_renderBatcher->SetLayer(eRenderLayer::WORLD);
+    m_entityRenderSystem->Render(m_world, eEntityKind::PLAYER_SHIP, *m_renderBatcher);
+    m_entityRenderSystem->Render(m_world, eEntityKind::BULLET, *m_renderBatcher);
+    m_entityRenderSystem->Render(m_world, eEntityKind::ASTEROID, *m_renderBatcher);
+    m_entityRenderSystem->Render(m_world, eEntityKind::BEETLE, *m_renderBatcher);
+    m_entityRenderSystem->Render(m_world, eEntityKind::WASP, *m_renderBatcher);
+    m_debrisSystem->Render(*m_renderBatcher, *m_workerPool);
+    m_boxWall->Render(*m_renderBatcher);
+}
+
+void Game::RenderDevConsole() const
+{
+    AABB2 const box = AABB2(Vec2::ZERO, Vec2(1600.f, 100.f));
 
-    for (int bulletIndex = 0; bulletIndex < MAX_BULLETS_NUM; bulletIndex++)
-    {
-        if (!m_bullets[bulletIndex]) continue;
+    g_devConsole->Render(box);
+}
 
+//----------------------------------------------------------------------------------------------------
+void Game::DebugRenderEntities() const
+{
+    if (!m_isDebugRendering) return;
 
-        m_bullets[bulletIndex]->Render();
-    }
+    sTransform const* playerShipTransform = m_world.Get<sTransform>(m_playerShipHandle);
+    Vec2 const*       playerShipPos       = playerShipTransform != nullptr ? &playerShipTransform->m_position : nullptr;
+
+    m_renderBatcher->SetLayer(eRenderLayer::WORLD_DEBUG);
+    m_entityRenderSystem->DebugRender(m_world, eEntityKind::PLAYER_SHIP, nullptr, *m_renderBatcher);
+    m_entityRenderSystem->DebugRender(m_world, eEntityKind::BULLET, playerShipPos, *m_renderBatcher);
+    m_entityRenderSystem->DebugRender(m_world, eEntityKind::ASTEROID, playerShipPos, *m_renderBatcher);
+    m_entityRenderSystem->DebugRender(m_world, eEntityKind::BEETLE, playerShipPos, *m_renderBatcher);
+    m_entityRenderSystem->DebugRender(m_world, eEntityKind::WASP, playerShipPos, *m_renderBatcher);
+    if (playerShipPos != nullptr) m_debrisSystem->DebugRender(*playerShipPos, *m_renderBatcher);
+    m_boxWall->DebugRender(*m_renderBatcher);
+}
 
-    for (int asteroidIndex = 0; asteroidIndex < MAX_ASTEROIDS_NUM; asteroidIndex++)
+void Game::SpawnRandomEnemy(Vec2 const& position)
+{
+    switch (g_rng->RollRandomIntInRange(0, 2))
     {
-        if (!m_asteroids[asteroidIndex]) continue;
+    case 0:
+        SpawnAsteroid(position);
+        break;
+
+    case 1:
+        SpawnBeetle(position);
+        break;
 
-        m_asteroids[asteroidIndex]->Render();
+    case 2:
+        SpawnWasp(position);
+        break;
     }
+}
 
-    for (int beetleIndex = 0; beetleIndex < MAX_BEETLE_NUM; beetleIndex++)
-    {
-        if (!m_beetle[beetleIndex]) continue;
+//----------------------------------------------------------------------------------------------------
+// Feeds every live enemy to the active broadphase. Bullets and the player ship are the queriers,
+// so they stay out of it, and the box wall answers its own queries.
+//
+void Game::RebuildBroadphase()
+{
+    bool const isGrid = m_broadphase == eBroadphase::GRID;
 
-        m_beetle[beetleIndex]->Render();
-    }
+    if (isGrid) m_collisionGrid->Clear();
+    else m_sweepAndPrune->Clear();
 
-    for (int waspIndex = 0; waspIndex < MAX_WASP_NUM; waspIndex++)
+    for (int kindIndex = 0; kindIndex < static_cast<int>(eEntityKind::NUM); ++kindIndex)
     {
-        if (!m_wasp[waspIndex]) continue;
+        eEntityKind const kind = static_cast<eEntityKind>(kindIndex);
 
-        m_wasp[waspIndex]->Render();
-    }
+        if (!m_world.GetArchetype(kind).HasComponents(MakeEcsMask(eEcsComponent::TAG_ENEMY))) continue;
 
-    for (int debrisIndex = 0; debrisIndex < MAX_DEBRIS_NUM; debrisIndex++)
-    {
-        if (!m_debris[debrisIndex]) continue;
+        m_world.ForEachOfKind<EntityHandle, sTransform, sHealth, sCollider>(kind, [this, kind, isGrid](EntityHandle const& handle, sTransform const& transform, sHealth const& health, sCollider const& collider)
+        {
+            if (health.m_isDead) return;
 
+            sBroadphaseEntry const entry = {transform.m_position, collider.m_physicsRadius, handle, kind};
 
-        m_debris[debrisIndex]->Render();
+            if (isGrid) m_collisionGrid->Insert(entry);
+            else m_sweepAndPrune->Insert(entry);
+        });
     }
-    for (int boxIndex = 0; boxIndex < MAX_BOX_NUM; boxIndex++)
-    {
-        if (!m_boxes[boxIndex]) continue;
 
-        m_boxes[boxIndex]->Render();
-    }
+    if (isGrid) m_collisionGrid->Build();
+    else m_sweepAndPrune->Build();
 }
 
-void Game::RenderDevConsole() const
+//----------------------------------------------------------------------------------------------------
+template <typename Func>
+void Game::ForEachEnemyOverlap(Vec2 const& center, float const radius, Func&& func) const
 {
-    AABB2 const box = AABB2(Vec2::ZERO, Vec2(1600.f, 100.f));
-
-    g_devConsole->Render(box);
+    if (m_broadphase == eBroadphase::GRID) m_collisionGrid->ForEachOverlap(center, radius, func);
+    else m_sweepAndPrune->ForEachOverlap(center, radius, func);
 }
 
 //----------------------------------------------------------------------------------------------------
-void Game::DebugRenderEntities() const
+template <typename Func>
+void Game::ForEachEnemyCandidateAlongSegment(Vec2 const& start, Vec2 const& displacement, float const radius, Func&& func) const
 {
-    if (!m_isDebugRendering) return;
+    if (m_broadphase == eBroadphase::GRID) m_collisionGrid->ForEachCandidateAlongSegment(start, displacement, radius, func);
+    else m_sweepAndPrune->ForEachCandidateAlongSegment(start, displacement, radius, func);
+}
 
-    if (m_playerShip) m_playerShip->DebugRender();
+//----------------------------------------------------------------------------------------------------
+template <typename Func>
+void Game::ForEachSweepHit(sSweepQuery const& query, Func&& func) const
+{
+    Vec2 const displacement = query.m_direction * query.m_maxLength;
 
-    for (int bulletIndex = 0; bulletIndex < MAX_BULLETS_NUM; ++bulletIndex)
+    ForEachEnemyCandidateAlongSegment(query.m_start, displacement, query.m_radius, [&](sBroadphaseEntry const& enemy)
     {
-        if (!m_bullets[bulletIndex]) continue;
+        float hitFraction;
 
-        m_bullets[bulletIndex]->DebugRender();
-    }
+        if (!SweepDiscAgainstDisc(query.m_start, displacement, query.m_radius, enemy.m_center, enemy.m_radius, hitFraction)) return;
 
-    for (int asteroidIndex = 0; asteroidIndex < MAX_ASTEROIDS_NUM; ++asteroidIndex)
-    {
-        if (!m_asteroids[asteroidIndex]) continue;
+        // The entry may outlive its entity, deleted as garbage since the last rebuild
+        sHealth const* health = m_world.Get<sHealth>(enemy.m_handle);
+        if (health == nullptr || health->m_isDead) return;
 
-        m_asteroids[asteroidIndex]->DebugRender();
-    }
+        sSweepHit hit    = MakeSweepHitOnDisc(query, hitFraction, enemy.m_center);
+        hit.m_kind       = eSweepHitKind::ENEMY;
+        hit.m_entity     = enemy.m_handle;
+        hit.m_entityKind = enemy.m_kind;
 
-    for (int beetleIndex = 0; beetleIndex < MAX_BEETLE_NUM; ++beetleIndex)
-    {
-        if (!m_beetle[beetleIndex]) continue;
-
-        m_beetle[beetleIndex]->DebugRender();
-    }
+        func(hit);
+    });
 
-    for (int waspIndex = 0; waspIndex < MAX_WASP_NUM; ++waspIndex)
+    m_boxWall->ForEachBoxAlongSweep(query.m_start, displacement, query.m_radius, [&](sBoxWallCell const& cell, float const hitFraction)
     {
-        if (!m_wasp[waspIndex]) continue;
+        sSweepHit hit   = MakeSweepHitOnAABB(query, hitFraction, m_boxWall->GetCellBounds(cell));
+        hit.m_kind      = eSweepHitKind::BOX;
+        hit.m_boxColumn = static_cast<uint16_t>(cell.m_column);
+        hit.m_boxRow    = static_cast<uint8_t>(cell.m_row);
 
-        m_wasp[waspIndex]->DebugRender();
-    }
+        func(hit);
+    });
+}
 
-    for (int debrisIndex = 0; debrisIndex < MAX_DEBRIS_NUM; ++debrisIndex)
-    {
-        if (!m_debris[debrisIndex]) continue;
+// #TODO: fix debris velocity
+//----------------------------------------------------------------------------------------------------
+// Detection only reads the world and records what touched what; every side effect (damage, debris,
+// sounds, score, spawns) happens afterwards in ApplyCollisionHits. Enemy pairs come from a
+// broadphase query narrowed by the batched disc kernel, so the cost follows how crowded each
+// querier's neighbourhood is rather than how many entities are alive.
+//
+// Detection is split into tasks by pair type and by fixed bullet ranges, each with its own buffer,
+// and spread over m_workerPool. Buffers are applied in task order, which is the order a single
+// thread would have found the hits in, so the outcome is the same for any number of threads.
+//
+void Game::HandleEntityCollision(float const deltaSeconds)
+{
+    RebuildBroadphase();
 
-        m_debris[debrisIndex]->DebugRender();
+    for (CollisionCommandBuffer& commands : m_collisionCommandBuffers)
+    {
+        commands.Clear();
     }
 
-    for (int boxIndex = 0; boxIndex < MAX_BOX_NUM; ++boxIndex)
+    int const numBullets     = m_world.GetArchetype(eEntityKind::BULLET).GetNumEntities();
+    int const numBulletTasks = (numBullets + COLLISION_BULLETS_PER_TASK - 1) / COLLISION_BULLETS_PER_TASK;
+    int const lastTask       = static_cast<int>(m_collisionCommandBuffers.size()) - 1;
+
+    m_workerPool->ParallelFor(numBulletTasks + 2, [this, deltaSeconds, numBullets, numBulletTasks, lastTask](int const taskIndex)
     {
-        if (!m_boxes[boxIndex]) continue;
+        if (taskIndex == 0)
+        {
+            DetectPlayerShipHits(m_collisionCommandBuffers[0]);
+        }
+        else if (taskIndex > numBulletTasks)
+        {
+            DetectPlayerShipBoxWallHits(m_collisionCommandBuffers[lastTask]);
+        }
+        else
+        {
+            int const firstRow = (taskIndex - 1) * COLLISION_BULLETS_PER_TASK;
+            int const endRow   = std::min(firstRow + COLLISION_BULLETS_PER_TASK, numBullets);
 
-        m_boxes[boxIndex]->DebugRender();
-    }
+            DetectBulletHits(deltaSeconds, firstRow, endRow, m_collisionCommandBuffers[taskIndex]);
+        }
+    });
+
+    ApplyCollisionHits();
 }
 
-void Game::SpawnRandomEnemy(int boxIndex)
+//----------------------------------------------------------------------------------------------------
+// The ship dies on contact, so only the first enemy it overlaps matters.
+//
+void Game::DetectPlayerShipHits(CollisionCommandBuffer& out_commands) const
 {
-    switch (g_rng->RollRandomIntInRange(0, 2))
+    sTransform const* playerShipTransform = m_world.Get<sTransform>(m_playerShipHandle);
+    sHealth const*    playerShipHealth    = m_world.Get<sHealth>(m_playerShipHandle);
+    sCollider const*  playerShipCollider  = m_world.Get<sCollider>(m_playerShipHandle);
+
+    if (playerShipHealth == nullptr || playerShipHealth->m_isDead) return;
+
+    constexpr uint32_t targetMask = GetCollisionTargetMask(eEntityKind::PLAYER_SHIP);
+
+    bool isHit = false;
+
+    ForEachEnemyOverlap(playerShipTransform->m_position, playerShipCollider->m_physicsRadius, [&](sBroadphaseEntry const& enemy)
     {
-    case 0:
-        SpawnAsteroid(m_boxes[boxIndex]->GetBoxCollider().GetCenter());
-        break;
+        if (isHit || (targetMask & (1u << static_cast<int>(enemy.m_kind))) == 0) return;
+        if (m_world.Get<sHealth>(enemy.m_handle)->m_isDead) return;
 
-    case 1:
-        SpawnBeetle(m_boxes[boxIndex]->GetBoxCollider().GetCenter());
-        break;
+        sCollisionHit hit;
+        hit.m_kind     = eCollisionHitKind::PLAYER_SHIP_VS_ENEMY;
+        hit.m_position = playerShipTransform->m_position;
+        hit.m_source   = m_playerShipHandle;
+        hit.m_target   = enemy.m_handle;
 
-    case 2:
-        SpawnWasp(m_boxes[boxIndex]->GetBoxCollider().GetCenter());
-        break;
-    }
+        out_commands.Push(hit);
+        isHit = true;
+    });
 }
 
-// #TODO: fix debris velocity
 //----------------------------------------------------------------------------------------------------
-void Game::HandleEntityCollision()
+// Bullets are swept along the step MovementSystem is about to take and record whichever enemy or
+// box they reach first, so a long frame cannot carry them through a target; targets are tested
+// where they stand. Each bullet records at most one hit, and is tested against every kind it collides
+// with in the same query; the matrix only decides which candidates count.
+//
+void Game::DetectBulletHits(float const deltaSeconds, int const firstRow, int const endRow, CollisionCommandBuffer& out_commands) const
 {
-    // PlayerShip vs. Asteroid
-    for (int asteroidIndex = 0; asteroidIndex < MAX_ASTEROIDS_NUM; ++asteroidIndex)
+    constexpr float    bulletRadius = ENTITY_TRAITS<eEntityKind::BULLET>.m_physicsRadius;
+    constexpr uint32_t targetMask   = GetCollisionTargetMask(eEntityKind::BULLET);
+
+    EcsArchetype const& bullets = m_world.GetArchetype(eEntityKind::BULLET);
+
+    for (int row = firstRow; row < endRow; ++row)
     {
-        if (!m_asteroids[asteroidIndex]) continue;
+        EntityHandle const bulletHandle    = *bullets.GetComponent<EntityHandle>(row);
+        sTransform const&  bulletTransform = *bullets.GetComponent<sTransform>(row);
+        sVelocity const&   bulletVelocity  = *bullets.GetComponent<sVelocity>(row);
+        sHealth const&     bulletHealth    = *bullets.GetComponent<sHealth>(row);
 
-        if (!m_playerShip) continue;
+        if (bulletHealth.m_isDead) continue;
 
-        if (m_playerShip->IsDead()) continue;
+        Vec2 const  start        = bulletTransform.m_position;
+        Vec2 const  displacement = bulletVelocity.m_velocity * deltaSeconds;
+        float const halfLength   = displacement.GetLength() * 0.5f;
 
-        if (DoDiscsOverlap2D(m_playerShip->GetPosition(),
-                             PLAYER_SHIP_PHYSICS_RADIUS,
-                             m_asteroids[asteroidIndex]->GetPosition(),
-                             ASTEROID_PHYSICS_RADIUS))
-        {
-            m_playerShip->m_health--;
-            m_playerShip->MarkAsDead();
-            m_playerShipHealth = m_playerShip->m_health;
-            m_asteroids[asteroidIndex]->m_health--;
-
-            const SoundID IN_GAME_ENTITY_HIT = g_audio->CreateOrGetSound("Data/Audio/InGame_Entity_Hit.mp3", eAudioSystemSoundDimension::Sound2D);
-            g_audio->StartSound(IN_GAME_ENTITY_HIT, false, 1.f, 0.f, 1.f, false);
-
-            SpawnDebrisCluster(m_playerShip->GetPosition(),
-                               m_asteroids[asteroidIndex]->GetVelocity().GetNormalized() * m_debrisVelocityRate,
-                               30,
-                               ENTITY_DEAD_DEBRIS_RADIUS,
-                               m_playerShip->GetColor());
-        }
+        EntityHandle firstEnemy;
+        float        enemyHitFraction = 1.f;
 
-        if (m_asteroids[asteroidIndex]->m_health == 0)
+        // The disc around the swept segment is a cheap superset of the capsule it sweeps out
+        ForEachEnemyOverlap(start + displacement * 0.5f, halfLength + bulletRadius, [&](sBroadphaseEntry const& enemy)
         {
-            SpawnDebrisCluster(m_asteroids[asteroidIndex]->GetPosition(),
-                               -m_asteroids[asteroidIndex]->GetVelocity().GetNormalized() * m_debrisVelocityRate,
-                               12,
-                               ENTITY_DEAD_DEBRIS_RADIUS,
-                               m_asteroids[asteroidIndex]->GetColor());
-
-            m_asteroids[asteroidIndex]->MarkAsDead();
-            m_asteroids[asteroidIndex]->MarkAsGarbage();
-        }
-    }
+            if ((targetMask & (1u << static_cast<int>(enemy.m_kind))) == 0) return;
 
-    // PlayerShip vs. Beetle
-    for (int beetleIndex = 0; beetleIndex < MAX_BEETLE_NUM; ++beetleIndex)
-    {
-        if (!m_beetle[beetleIndex]) continue;
+            float hitFraction;
+
+            if (!SweepDiscAgainstDisc(start, displacement, bulletRadius, enemy.m_center, enemy.m_radius, hitFraction)) return;
+            if (firstEnemy.IsValid() && hitFraction >= enemyHitFraction) return;
+            if (m_world.Get<sHealth>(enemy.m_handle)->m_isDead) return;
 
-        if (!m_playerShip) continue;
+            firstEnemy       = enemy.m_handle;
+            enemyHitFraction = hitFraction;
+        });
 
-        if (m_playerShip->IsDead()) continue;
+        sBoxWallCell cell;
+        float        boxHitFraction = 1.f;
+        bool const   isBoxHit       = m_boxWall->TryGetFirstCellAlongSegment(start, displacement, cell, boxHitFraction);
 
+        sCollisionHit hit;
+        hit.m_source = bulletHandle;
 
-        if (DoDiscsOverlap2D(m_playerShip->GetPosition(),
-                             PLAYER_SHIP_PHYSICS_RADIUS,
-                             m_beetle[beetleIndex]->GetPosition(),
-                             BEETLE_PHYSICS_RADIUS))
+        if (isBoxHit && (!firstEnemy.IsValid() || boxHitFraction < enemyHitFraction))
+        {
+            hit.m_kind      = eCollisionHitKind::BULLET_VS_BOX;
+            hit.m_position  = start + displacement * boxHitFraction;
+            hit.m_boxColumn = static_cast<uint16_t>(cell.m_column);
+            hit.m_boxRow    = static_cast<uint8_t>(cell.m_row);
+        }
+        else if (firstEnemy.IsValid())
+        {
+            hit.m_kind     = eCollisionHitKind::BULLET_VS_ENEMY;
+            hit.m_position = start + displacement * enemyHitFraction;
+            hit.m_target   = firstEnemy;
+        }
+        else
         {
-            m_playerShip->m_health--;
-            m_playerShip->MarkAsDead();
-            m_playerShipHealth = m_playerShip->m_health;
-            m_beetle[beetleIndex]->m_health--;
+            continue;
+        }
 
-            const SoundID IN_GAME_ENTITY_HIT = g_audio->CreateOrGetSound("Data/Audio/InGame_Entity_Hit.mp3", eAudioSystemSoundDimension::Sound2D);
-            g_audio->StartSound(IN_GAME_ENTITY_HIT, false, 1.f, 0.f, 1.f, false);
+        out_commands.Push(hit);
+    }
+}
 
-            SpawnDebrisCluster(m_playerShip->GetPosition(),
-                               m_beetle[beetleIndex]->GetVelocity().GetNormalized() * m_debrisVelocityRate,
-                               30,
-                               ENTITY_DEAD_DEBRIS_RADIUS,
-                               m_playerShip->GetColor());
+//----------------------------------------------------------------------------------------------------
+// Every box the ship's cosmetic disc overlaps where it stands; ApplyPlayerShipHitOnBox re-checks each
+// against where earlier push-outs have moved it.
+//
+void Game::DetectPlayerShipBoxWallHits(CollisionCommandBuffer& out_commands) const
+{
+    sTransform const* playerShipTransform = m_world.Get<sTransform>(m_playerShipHandle);
+    sHealth const*    playerShipHealth    = m_world.Get<sHealth>(m_playerShipHandle);
+    sCollider const*  playerShipCollider  = m_world.Get<sCollider>(m_playerShipHandle);
 
-            continue;
-        }
+    if (playerShipHealth == nullptr || playerShipHealth->m_isDead) return;
+
+    m_boxWall->ForEachBoxOverlappingDisc(playerShipTransform->m_position, playerShipCollider->m_cosmeticRadius, [&](sBoxWallCell const& cell)
+    {
+        sCollisionHit hit;
+        hit.m_kind      = eCollisionHitKind::PLAYER_SHIP_VS_BOX;
+        hit.m_position  = playerShipTransform->m_position;
+        hit.m_source    = m_playerShipHandle;
+        hit.m_boxColumn = static_cast<uint16_t>(cell.m_column);
+        hit.m_boxRow    = static_cast<uint8_t>(cell.m_row);
+
+        out_commands.Push(hit);
+    });
+}
 
-        if (m_beetle[beetleIndex]->m_health == 0)
+//----------------------------------------------------------------------------------------------------
+// The single sync point where hits turn into damage, debris, sounds, score and spawns, buffer by
+// buffer in task order. A hit whose target an earlier hit already destroyed this frame is dropped
+// and its bullet flies on, so every kill is counted once.
+//
+// Entity hits are dispatched on the target's kind to the specialization for that pair, so scores and
+// debris counts come from ENTITY_KIND_TRAITS as constants instead of being loaded per hit.
+//
+void Game::ApplyCollisionHits()
+{
+    for (CollisionCommandBuffer const& commands : m_collisionCommandBuffers)
+    {
+        for (sCollisionHit const& hit : commands.GetHits())
         {
-            SpawnDebrisCluster(m_beetle[beetleIndex]->GetPosition(),
-                               m_beetle[beetleIndex]->GetVelocity().GetNormalized() * m_debrisVelocityRate,
-                               12,
-                               ENTITY_DEAD_DEBRIS_RADIUS,
-                               m_beetle[beetleIndex]->GetColor());
-
-            m_beetle[beetleIndex]->MarkAsDead();
-            m_beetle[beetleIndex]->MarkAsGarbage();
+            switch (hit.m_kind)
+            {
+            case eCollisionHitKind::PLAYER_SHIP_VS_ENEMY:
+                DispatchCollisionTarget<eEntityKind::PLAYER_SHIP>(m_world.GetKind(hit.m_target), [this, &hit]<eEntityKind Target>()
+                {
+                    ApplyPlayerShipHitOnEnemy<Target>(hit);
+                });
+                break;
+
+            case eCollisionHitKind::BULLET_VS_ENEMY:
+                DispatchCollisionTarget<eEntityKind::BULLET>(m_world.GetKind(hit.m_target), [this, &hit]<eEntityKind Target>()
+                {
+                    ApplyBulletHitOnEnemy<Target>(hit);
+                });
+                break;
+
+            case eCollisionHitKind::PLAYER_SHIP_VS_BOX: ApplyPlayerShipHitOnBox(hit); break;
+            case eCollisionHitKind::BULLET_VS_BOX: ApplyBulletHitOnBoxWall(hit); break;
+            }
         }
     }
+}
 
-    // PlayerShip vs. Wasp
-    for (int waspIndex = 0; waspIndex < MAX_WASP_NUM; ++waspIndex)
-    {
-        if (!m_wasp[waspIndex]) continue;
+//----------------------------------------------------------------------------------------------------
+template <eEntityKind Target>
+void Game::ApplyPlayerShipHitOnEnemy(sCollisionHit const& hit)
+{
+    sHealth& playerShipHealth = *m_world.Get<sHealth>(hit.m_source);
+    sHealth& enemyHealth      = *m_world.Get<sHealth>(hit.m_target);
 
-        if (!m_playerShip) continue;
+    if (playerShipHealth.m_isDead || enemyHealth.m_isDead) return;
 
-        if (m_playerShip->IsDead()) continue;
+    Vec2 const  enemyVelocity = m_world.Get<sVelocity>(hit.m_target)->m_velocity;
+    Rgba8 const enemyColor    = m_world.Get<sMeshRef>(hit.m_target)->m_color;
 
+    PlayEntityHitSound();
 
-        if (DoDiscsOverlap2D(m_playerShip->GetPosition(),
-                             PLAYER_SHIP_PHYSICS_RADIUS,
-                             m_wasp[waspIndex]->GetPosition(),
-                             WASP_PHYSICS_RADIUS))
-        {
-            const SoundID IN_GAME_ENTITY_HIT = g_audio->CreateOrGetSound("Data/Audio/InGame_Entity_Hit.mp3", eAudioSystemSoundDimension::Sound2D);
-            g_audio->StartSound(IN_GAME_ENTITY_HIT, false, 1.f, 0.f, 1.f, false);
-
-            m_playerShip->m_health--;
-            m_playerShip->MarkAsDead();
-            m_playerShipHealth = m_playerShip->m_health;
-            m_wasp[waspIndex]->m_health--;
-
-            SpawnDebrisCluster(m_playerShip->GetPosition(),
-                               m_wasp[waspIndex]->GetVelocity().GetNormalized() * m_debrisVelocityRate,
-                               30,
-                               ENTITY_DEAD_DEBRIS_RADIUS,
-                               m_playerShip->GetColor());
-        }
+    playerShipHealth.m_health--;
+    playerShipHealth.m_isDead = true;
+    m_playerShipHealth        = playerShipHealth.m_health;
 
+    SpawnDebrisCluster(hit.m_position,
+                       enemyVelocity.GetNormalized() * m_debrisVelocityRate,
+                       ENTITY_TRAITS<eEntityKind::PLAYER_SHIP>.m_deathDebrisNum,
+                       ENTITY_DEAD_DEBRIS_RADIUS,
+                       m_world.Get<sMeshRef>(hit.m_source)->m_color);
 
-        if (m_wasp[waspIndex]->m_health == 0)
-        {
-            SpawnDebrisCluster(m_wasp[waspIndex]->GetPosition(),
-                               -m_wasp[waspIndex]->GetVelocity().GetNormalized() * m_debrisVelocityRate,
-                               12,
-                               ENTITY_DEAD_DEBRIS_RADIUS,
-                               m_wasp[waspIndex]->GetColor());
-
-            m_wasp[waspIndex]->MarkAsDead();
-            m_wasp[waspIndex]->MarkAsGarbage();
-        }
-    }
+    ApplyDamage(enemyHealth,
+                m_world.Get<sTransform>(hit.m_target)->m_position,
+                -enemyVelocity.GetNormalized() * m_debrisVelocityRate,
+                enemyColor,
+                ENTITY_TRAITS<Target>.m_deathDebrisNum);
+}
 
+//----------------------------------------------------------------------------------------------------
+// Pushes the ship out of the box and reflects its velocity off the face it hit. Skipped if the ship
+// died or the box was shot away earlier at this sync point, or an earlier push-out already cleared it.
+//
+void Game::ApplyPlayerShipHitOnBox(sCollisionHit const& hit)
+{
+    sBoxWallCell const cell                = sBoxWallCell{hit.m_boxColumn, hit.m_boxRow};
+    sTransform&        playerShipTransform = *m_world.Get<sTransform>(hit.m_source);
+    sVelocity&         playerShipVelocity  = *m_world.Get<sVelocity>(hit.m_source);
+    sHealth const&     playerShipHealth    = *m_world.Get<sHealth>(hit.m_source);
+    sCollider const&   playerShipCollider  = *m_world.Get<sCollider>(hit.m_source);
 
-    //  Bullet vs. Asteroid
-    for (int asteroidIndex = 0; asteroidIndex < MAX_ASTEROIDS_NUM; ++asteroidIndex)
+    if (playerShipHealth.m_isDead || !m_boxWall->HasBox(cell)) return;
+
+    AABB2 const boxBounds = m_boxWall->GetCellBounds(cell);
+
+    if (!DoDiscsOverlap2D(playerShipTransform.m_position, playerShipCollider.m_cosmeticRadius,
+                          boxBounds.GetCenter(), BOX_SIDE_LENGTH / 2.f))
     {
-        for (int bulletIndex = 0; bulletIndex < MAX_BULLETS_NUM; ++bulletIndex)
-        {
-            if (!m_asteroids[asteroidIndex]) continue;
+        return;
+    }
 
+    PushDiscOutOfAABB2D(playerShipTransform.m_position, playerShipCollider.m_physicsRadius,
+                        boxBounds);
 
-            if (!m_bullets[bulletIndex]) continue;
+    SpawnDebrisCluster(playerShipTransform.m_position,
+                       -playerShipVelocity.m_velocity.GetNormalized() * m_debrisVelocityRate,
+                       ENTITY_TRAITS<eEntityKind::PLAYER_SHIP>.m_hitDebrisNum,
+                       ENTITY_DEAD_DEBRIS_RADIUS,
+                       m_world.Get<sMeshRef>(hit.m_source)->m_color);
 
-            if (DoDiscsOverlap2D(m_bullets[bulletIndex]->GetPosition(),
-                                 BULLET_PHYSICS_RADIUS,
-                                 m_asteroids[asteroidIndex]->GetPosition(),
-                                 ASTEROID_PHYSICS_RADIUS))
-            {
-                const SoundID IN_GAME_ENTITY_HIT = g_audio->CreateOrGetSound("Data/Audio/InGame_Entity_Hit.mp3", eAudioSystemSoundDimension::Sound2D);
-                g_audio->StartSound(IN_GAME_ENTITY_HIT, false, 1.f, 0.f, 1.f, false);
+    Vec2       nearestPoint                  = boxBounds.GetNearestPoint(playerShipTransform.m_position);
+    Vec2       normalOfSurfaceToReflectOffOf = (playerShipTransform.m_position - nearestPoint).GetNormalized();
+    const Vec2 newVelocity                   = playerShipVelocity.m_velocity.GetReflected(normalOfSurfaceToReflectOffOf);
 
-                SpawnDebrisCluster(m_bullets[bulletIndex]->GetPosition(),
-                                   m_asteroids[asteroidIndex]->GetVelocity().GetNormalized() * m_debrisVelocityRate,
-                                   3,
-                                   ENTITY_HIT_DEBRIS_RADIUS,
-                                   m_asteroids[asteroidIndex]->GetColor());
+    playerShipVelocity.m_velocity = newVelocity;
+}
 
-                m_playerShip->m_score += 10;
+//----------------------------------------------------------------------------------------------------
+template <eEntityKind Target>
+void Game::ApplyBulletHitOnEnemy(sCollisionHit const& hit)
+{
+    constexpr sEntityKindTraits traits = ENTITY_TRAITS<Target>;
 
-                m_bullets[bulletIndex]->MarkAsDead();
-                m_bullets[bulletIndex]->MarkAsGarbage();
-                m_asteroids[asteroidIndex]->m_health--;
-            }
+    sHealth& bulletHealth = *m_world.Get<sHealth>(hit.m_source);
+    sHealth& enemyHealth  = *m_world.Get<sHealth>(hit.m_target);
 
-            if (m_asteroids[asteroidIndex]->m_health != 0) continue;
+    if (bulletHealth.m_isDead || enemyHealth.m_isDead) return;
 
-            SpawnDebrisCluster(m_asteroids[asteroidIndex]->GetPosition(),
-                               -m_asteroids[asteroidIndex]->GetVelocity().GetNormalized() * m_debrisVelocityRate,
-                               12,
-                               ENTITY_DEAD_DEBRIS_RADIUS,
-                               m_asteroids[asteroidIndex]->GetColor());
+    Vec2 const  enemyVelocity = m_world.Get<sVelocity>(hit.m_target)->m_velocity;
+    Rgba8 const enemyColor    = m_world.Get<sMeshRef>(hit.m_target)->m_color;
 
-            m_playerShip->m_score += 100;
+    PlayEntityHitSound();
 
-            m_asteroids[asteroidIndex]->MarkAsDead();
-            m_asteroids[asteroidIndex]->MarkAsGarbage();
-        }
-    }
+    SpawnDebrisCluster(hit.m_position,
+                       enemyVelocity.GetNormalized() * m_debrisVelocityRate,
+                       traits.m_hitDebrisNum,
+                       ENTITY_HIT_DEBRIS_RADIUS,
+                       enemyColor);
 
+    AddPlayerScore(traits.m_hitScore);
 
-    // Bullets vs. Beetle
-    for (int bulletIndex = 0; bulletIndex < MAX_BULLETS_NUM; ++bulletIndex)
+    bulletHealth.m_isDead    = true;
+    bulletHealth.m_isGarbage = true;
+
+    if (ApplyDamage(enemyHealth,
+                    m_world.Get<sTransform>(hit.m_target)->m_position,
+                    -enemyVelocity.GetNormalized() * m_debrisVelocityRate,
+                    enemyColor,
+                    traits.m_deathDebrisNum))
     {
-        for (int beetleIndex = 0; beetleIndex < MAX_BEETLE_NUM; ++beetleIndex)
-        {
-            if (!m_bullets[bulletIndex]) continue;
+        AddPlayerScore(traits.m_killScore);
+    }
+}
 
+//----------------------------------------------------------------------------------------------------
+void Game::ApplyBulletHitOnBoxWall(sCollisionHit const& hit)
+{
+    sBoxWallCell const cell         = sBoxWallCell{hit.m_boxColumn, hit.m_boxRow};
+    sHealth&           bulletHealth = *m_world.Get<sHealth>(hit.m_source);
 
-            if (!m_beetle[beetleIndex]) continue;
+    if (bulletHealth.m_isDead || !m_boxWall->HasBox(cell)) return;
 
-            if (DoDiscsOverlap2D(m_bullets[bulletIndex]->GetPosition(),
-                                 BULLET_PHYSICS_RADIUS,
-                                 m_beetle[beetleIndex]->GetPosition(),
-                                 BEETLE_PHYSICS_RADIUS))
-            {
-                const SoundID IN_GAME_ENTITY_HIT = g_audio->CreateOrGetSound("Data/Audio/InGame_Entity_Hit.mp3", eAudioSystemSoundDimension::Sound2D);
-                g_audio->StartSound(IN_GAME_ENTITY_HIT, false, 1.f, 0.f, 1.f, false);
+    Vec2 const bulletVelocity = m_world.Get<sVelocity>(hit.m_source)->m_velocity;
 
-                SpawnDebrisCluster(m_bullets[bulletIndex]->GetPosition(),
-                                   m_beetle[beetleIndex]->GetVelocity().GetNormalized() * m_debrisVelocityRate,
-                                   3,
-                                   ENTITY_HIT_DEBRIS_RADIUS,
-                                   m_beetle[beetleIndex]->GetColor());
+    PlayEntityHitSound();
 
-                m_playerShip->m_score += 20;
+    SpawnDebrisCluster(hit.m_position,
+                       -bulletVelocity.GetNormalized() * m_debrisVelocityRate,
+                       BOX_HIT_DEBRIS_NUM,
+                       ENTITY_HIT_DEBRIS_RADIUS,
+                       BOX_COLOR);
 
-                m_bullets[bulletIndex]->MarkAsDead();
-                m_bullets[bulletIndex]->MarkAsGarbage();
-                m_beetle[beetleIndex]->m_health--;
-            }
+    AddPlayerScore(BOX_HIT_SCORE);
 
-            if (m_beetle[beetleIndex]->m_health != 0) continue;
+    bulletHealth.m_isDead    = true;
+    bulletHealth.m_isGarbage = true;
 
-            SpawnDebrisCluster(m_beetle[beetleIndex]->GetPosition(),
-                               -m_beetle[beetleIndex]->GetVelocity().GetNormalized() * m_debrisVelocityRate,
-                               12,
-                               ENTITY_DEAD_DEBRIS_RADIUS,
-                               m_beetle[beetleIndex]->GetColor());
+    if (m_boxWall->DamageCell(cell))
+    {
+        AABB2 const boxBounds = m_boxWall->GetCellBounds(cell);
 
-            m_playerShip->m_score += 200;
+        SpawnDebrisCluster(boxBounds.m_mins,
+                           bulletVelocity.GetNormalized() * m_debrisVelocityRate,
+                           BOX_DEATH_DEBRIS_NUM,
+                           ENTITY_DEAD_DEBRIS_RADIUS,
+                           BOX_COLOR);
 
-            m_beetle[beetleIndex]->MarkAsDead();
-            m_beetle[beetleIndex]->MarkAsGarbage();
-        }
+        AddPlayerScore(BOX_KILL_SCORE);
+        SpawnRandomEnemy(boxBounds.GetCenter());
     }
+}
 
-    // Bullets vs. Wasp
-    for (int bulletIndex = 0; bulletIndex < MAX_BULLETS_NUM; ++bulletIndex)
-    {
-        for (int waspIndex = 0; waspIndex < MAX_WASP_NUM; ++waspIndex)
-        {
-            if (!m_bullets[bulletIndex]) continue;
+//----------------------------------------------------------------------------------------------------
+// Spawns the death debris and flags the entity once its health runs out; returns whether it died.
+//
+bool Game::ApplyDamage(sHealth& health, Vec2 const& debrisPosition, Vec2 const& debrisVelocity, Rgba8 const& color, int const numDeathDebris)
+{
+    health.m_health--;
 
-            if (!m_wasp[waspIndex]) continue;
+    if (health.m_health > 0) return false;
 
-            if (DoDiscsOverlap2D(m_bullets[bulletIndex]->GetPosition(),
-                                 BULLET_PHYSICS_RADIUS,
-                                 m_wasp[waspIndex]->GetPosition(),
-                                 WASP_PHYSICS_RADIUS))
-            {
-                const SoundID IN_GAME_ENTITY_HIT = g_audio->CreateOrGetSound("Data/Audio/InGame_Entity_Hit.mp3", eAudioSystemSoundDimension::Sound2D);
-                g_audio->StartSound(IN_GAME_ENTITY_HIT, false, 1.f, 0.f, 1.f, false);
+    SpawnDebrisCluster(debrisPosition,
+                       debrisVelocity,
+                       numDeathDebris,
+                       ENTITY_DEAD_DEBRIS_RADIUS,
+                       color);
 
-                SpawnDebrisCluster(m_bullets[bulletIndex]->GetPosition(),
-                                   m_wasp[waspIndex]->GetVelocity().GetNormalized() * m_debrisVelocityRate,
-                                   3,
-                                   ENTITY_HIT_DEBRIS_RADIUS,
-                                   m_wasp[waspIndex]->GetColor());
+    health.m_isDead    = true;
+    health.m_isGarbage = true;
 
-                m_playerShip->m_score += 50;
+    return true;
+}
 
-                m_bullets[bulletIndex]->MarkAsDead();
-                m_bullets[bulletIndex]->MarkAsGarbage();
-                m_wasp[waspIndex]->m_health--;
-            }
+//----------------------------------------------------------------------------------------------------
+// Ties go to whichever target was found first, which for a given broadphase is always the same one.
+//
+bool Game::SweepDiscFirstHit(sSweepQuery const& query, sSweepHit& out_hit) const
+{
+    bool isHit = false;
 
-            if (m_wasp[waspIndex]->m_health != 0) continue;
+    ForEachSweepHit(query, [&](sSweepHit const& hit)
+    {
+        if (isHit && hit.m_distance >= out_hit.m_distance) return;
 
-            SpawnDebrisCluster(m_wasp[waspIndex]->GetPosition(),
-                               -m_wasp[waspIndex]->GetVelocity().GetNormalized() * m_debrisVelocityRate,
-                               12,
-                               ENTITY_DEAD_DEBRIS_RADIUS,
-                               m_wasp[waspIndex]->GetColor());
+        out_hit = hit;
+        isHit   = true;
+    });
 
-            m_playerShip->m_score += 500;
+    return isHit;
+}
 
-            m_wasp[waspIndex]->MarkAsDead();
-            m_wasp[waspIndex]->MarkAsGarbage();
-        }
-    }
+//----------------------------------------------------------------------------------------------------
+void Game::SweepDiscAllHits(sSweepQuery const& query, std::vector<sSweepHit>& out_hits) const
+{
+    out_hits.clear();
 
-    // Bullets vs. Box
-    for (int bulletIndex = 0; bulletIndex < MAX_BULLETS_NUM; ++bulletIndex)
+    ForEachSweepHit(query, [&out_hits](sSweepHit const& hit)
     {
-        for (int boxIndex = 0; boxIndex < MAX_BOX_NUM; ++boxIndex)
-        {
-            if (!m_bullets[bulletIndex]) continue;
+        out_hits.push_back(hit);
+    });
 
-            if (!m_boxes[boxIndex]) continue;
+    std::stable_sort(out_hits.begin(), out_hits.end(), [](sSweepHit const& a, sSweepHit const& b)
+    {
+        return a.m_distance < b.m_distance;
+    });
+}
 
-            if (m_boxes[boxIndex]->GetBoxCollider().IsPointInside(m_bullets[bulletIndex]->GetPosition()))
-            {
-                const SoundID IN_GAME_ENTITY_HIT = g_audio->CreateOrGetSound("Data/Audio/InGame_Entity_Hit.mp3", eAudioSystemSoundDimension::Sound2D);
-                g_audio->StartSound(IN_GAME_ENTITY_HIT, false, 1.f, 0.f, 1.f, false);
+//----------------------------------------------------------------------------------------------------
+// Queries only read the world and each writes its own slot, so fixed ranges of them run as tasks.
+//
+void Game::SweepDiscsFirstHits(std::vector<sSweepQuery> const& queries, std::vector<sSweepHit>& out_hits) const
+{
+    int const numQueries = static_cast<int>(queries.size());
+    int const numTasks   = (numQueries + SWEEP_QUERIES_PER_TASK - 1) / SWEEP_QUERIES_PER_TASK;
 
-                SpawnDebrisCluster(m_bullets[bulletIndex]->GetPosition(),
-                                   -m_bullets[bulletIndex]->GetVelocity().GetNormalized() * m_debrisVelocityRate,
-                                   3,
-                                   ENTITY_HIT_DEBRIS_RADIUS,
-                                   m_boxes[boxIndex]->GetColor());
+    out_hits.resize(queries.size());
 
-                m_playerShip->m_score += 1;
+    m_workerPool->ParallelFor(numTasks, [this, &queries, &out_hits, numQueries](int const taskIndex)
+    {
+        int const firstQuery = taskIndex * SWEEP_QUERIES_PER_TASK;
+        int const endQuery   = std::min(firstQuery + SWEEP_QUERIES_PER_TASK, numQueries);
 
-                m_bullets[bulletIndex]->MarkAsDead();
-                m_bullets[bulletIndex]->MarkAsGarbage();
-                m_boxes[boxIndex]->m_health--;
-            }
+        for (int queryIndex = firstQuery; queryIndex < endQuery; ++queryIndex)
+        {
+            if (!SweepDiscFirstHit(queries[queryIndex], out_hits[queryIndex])) out_hits[queryIndex] = sSweepHit();
+        }
+    });
+}
 
-            if (m_boxes[boxIndex]->m_health != 0) continue;
+//----------------------------------------------------------------------------------------------------
+int Game::FindNearestEnemies(Vec2 const& center, float const maxDistance, int const maxNeighbors, sBroadphaseNeighbor* out_neighbors) const
+{
+    auto const isAlive = [this](sBroadphaseEntry const& enemy)
+    {
+        sHealth const* health = m_world.Get<sHealth>(enemy.m_handle); // null once deleted as garbage
+        return health != nullptr && !health->m_isDead;
+    };
 
-            SpawnDebrisCluster(m_boxes[boxIndex]->GetPosition(),
-                               m_bullets[bulletIndex]->GetVelocity().GetNormalized() * m_debrisVelocityRate,
-                               12,
-                               ENTITY_DEAD_DEBRIS_RADIUS,
-                               m_boxes[boxIndex]->GetColor());
+    if (m_broadphase == eBroadphase::GRID) return m_collisionGrid->FindNearest(center, maxDistance, maxNeighbors, out_neighbors, isAlive);
 
-            m_playerShip->m_score += 1;
+    return m_sweepAndPrune->FindNearest(center, maxDistance, maxNeighbors, out_neighbors, isAlive);
+}
 
-            m_boxes[boxIndex]->MarkAsDead();
-            m_boxes[boxIndex]->MarkAsGarbage();
+//----------------------------------------------------------------------------------------------------
+void Game::FindNearestEnemies(Vec2 const* centers, int const numQueries, float const maxDistance, int const maxNeighborsPerQuery,
+                              sBroadphaseNeighbor* out_neighbors, int* out_numNeighbors) const
+{
+    int const numTasks = (numQueries + NEIGHBOR_QUERIES_PER_TASK - 1) / NEIGHBOR_QUERIES_PER_TASK;
+
+    m_workerPool->ParallelFor(numTasks, [=, this](int const taskIndex)
+    {
+        int const firstQuery = taskIndex * NEIGHBOR_QUERIES_PER_TASK;
+        int const endQuery   = std::min(firstQuery + NEIGHBOR_QUERIES_PER_TASK, numQueries);
 
-            SpawnRandomEnemy(boxIndex);
+        for (int queryIndex = firstQuery; queryIndex < endQuery; ++queryIndex)
+        {
+            out_numNeighbors[queryIndex] = FindNearestEnemies(centers[queryIndex], maxDistance, maxNeighborsPerQuery,
+                                                              out_neighbors + static_cast<size_t>(queryIndex) * maxNeighborsPerQuery);
         }
-    }
-    HandleCollisionBetweenPlayerShipAndBox();
+    });
 }
 
-void Game::HandleCollisionBetweenPlayerShipAndBox()
+//----------------------------------------------------------------------------------------------------
+// The overlap query finds every enemy whose disc reaches the query disc, a superset of those centered
+// inside it.
+//
+int Game::FindEnemiesInRadius(Vec2 const& center, float const radius, int const maxNeighbors, sBroadphaseNeighbor* out_neighbors) const
 {
-    // PlayerShip vs. Box
-    for (int boxIndex = 0; boxIndex < MAX_BOX_NUM; ++boxIndex)
-    {
-        if (!m_boxes[boxIndex]) continue;
+    int numFound = 0;
 
-        if (!m_playerShip) continue;
+    ForEachEnemyOverlap(center, radius, [&](sBroadphaseEntry const& enemy)
+    {
+        float const distance = (enemy.m_center - center).GetLength();
 
-        if (m_playerShip->IsDead()) continue;
+        if (distance > radius) return;
 
-        if (DoDiscsOverlap2D(m_playerShip->GetPosition(),
-                             PLAYER_SHIP_COSMETIC_RADIUS,
-                             m_boxes[boxIndex]->GetBoxCollider().GetCenter(),
-                             BOX_SIDE_LENGTH / 2.f))
-        {
-            PushDiscOutOfAABB2D(m_playerShip->GetPositionAndSet(), PLAYER_SHIP_PHYSICS_RADIUS,
-                                m_boxes[boxIndex]->GetBoxCollider());
+        sHealth const* health = m_world.Get<sHealth>(enemy.m_handle); // null once deleted as garbage
+        if (health == nullptr || health->m_isDead) return;
 
-            SpawnDebrisCluster(m_playerShip->GetPosition(),
-                               -m_playerShip->GetVelocity().GetNormalized() * m_debrisVelocityRate,
-                               30,
-                               ENTITY_DEAD_DEBRIS_RADIUS,
-                               m_playerShip->GetColor());
+        if (numFound < maxNeighbors) out_neighbors[numFound] = {enemy.m_center, distance, enemy.m_handle, enemy.m_kind};
 
-            Vec2       nearestPoint                  = m_boxes[boxIndex]->GetBoxCollider().GetNearestPoint(m_playerShip->GetPosition());
-            Vec2       normalOfSurfaceToReflectOffOf = (m_playerShip->GetPosition() - nearestPoint).GetNormalized();
-            const Vec2 newVelocity                   = m_playerShip->GetVelocity().GetReflected(normalOfSurfaceToReflectOffOf);
+        ++numFound;
+    });
 
-            m_playerShip->GetVelocityAndSet() = newVelocity;
-        }
-    }
+    return numFound;
 }
 
-//-----------------------------------------------------------------------------------------------
-void Game::HandleEntityIsOffScreen() const
+//----------------------------------------------------------------------------------------------------
+void Game::AddPlayerScore(int const points) const
 {
-    for (int debrisIndex = 0; debrisIndex < MAX_DEBRIS_NUM; ++debrisIndex)
-    {
-        if (!m_debris[debrisIndex]) continue;
+    sPlayerControl* control = GetPlayerShipControl();
 
-        if (!m_debris[debrisIndex]->IsOffScreen()) continue;
-
-        m_debris[debrisIndex]->MarkAsDead();
-        m_debris[debrisIndex]->MarkAsGarbage();
-    }
+    if (control != nullptr) control->m_score += points;
+}
 
-    for (int bulletIndex = 0; bulletIndex < MAX_BULLETS_NUM; ++bulletIndex)
-    {
-        if (!m_bullets[bulletIndex]) continue;
+//----------------------------------------------------------------------------------------------------
+void Game::PlayEntityHitSound() const
+{
+    g_audio->StartSound(m_entityHitSound, false, 1.f, 0.f, 1.f, false);
+}
 
-        if (!m_bullets[bulletIndex]->IsOffScreen()) continue;
+//----------------------------------------------------------------------------------------------------
+sHealth* Game::GetPlayerShipHealth() const
+{
+    return m_world.Get<sHealth>(m_playerShipHandle);
+}
 
-        m_bullets[bulletIndex]->MarkAsDead();
-        m_bullets[bulletIndex]->MarkAsGarbage();
-    }
+//----------------------------------------------------------------------------------------------------
+sPlayerControl* Game::GetPlayerShipControl() const
+{
+    return m_world.Get<sPlayerControl>(m_playerShipHandle);
 }
 
 //-----------------------------------------------------------------------------------------------
@@ -1148,65 +1563,7 @@ Vec2 Game::GetOffScreenPosition(float entityCosmeticRadius) const
 //-----------------------------------------------------------------------------------------------
 void Game::DeleteGarbageEntities()
 {
-    for (int asteroidIndex = 0; asteroidIndex < MAX_ASTEROIDS_NUM; ++asteroidIndex)
-    {
-        if (m_asteroids[asteroidIndex] &&
-            m_asteroids[asteroidIndex]->IsGarbage())
-        {
-            delete m_asteroids[asteroidIndex];
-            m_asteroids[asteroidIndex] = nullptr;
-        }
-    }
-
-    for (int bulletIndex = 0; bulletIndex < MAX_BULLETS_NUM; ++bulletIndex)
-    {
-        if (m_bullets[bulletIndex] &&
-            m_bullets[bulletIndex]->IsGarbage())
-        {
-            delete m_bullets[bulletIndex];
-            m_bullets[bulletIndex] = nullptr;
-        }
-    }
-
-    for (int debrisIndex = 0; debrisIndex < MAX_DEBRIS_NUM; ++debrisIndex)
-    {
-        if (m_debris[debrisIndex] &&
-            m_debris[debrisIndex]->IsGarbage())
-        {
-            delete m_debris[debrisIndex];
-            m_debris[debrisIndex] = nullptr;
-        }
-    }
-
-    for (int beetleIndex = 0; beetleIndex < MAX_BEETLE_NUM; ++beetleIndex)
-    {
-        if (m_beetle[beetleIndex] &&
-            m_beetle[beetleIndex]->IsGarbage())
-        {
-            delete m_beetle[beetleIndex];
-            m_beetle[beetleIndex] = nullptr;
-        }
-    }
-
-    for (int waspIndex = 0; waspIndex < MAX_WASP_NUM; ++waspIndex)
-    {
-        if (m_wasp[waspIndex] &&
-            m_wasp[waspIndex]->IsGarbage())
-        {
-            delete m_wasp[waspIndex];
-            m_wasp[waspIndex] = nullptr;
-        }
-    }
-
-    for (int boxIndex = 0; boxIndex < MAX_BOX_NUM; ++boxIndex)
-    {
-        if (m_boxes[boxIndex] &&
-            m_boxes[boxIndex]->IsGarbage())
-        {
-            delete m_boxes[boxIndex];
-            m_boxes[boxIndex] = nullptr;
-        }
-    }
+    m_world.DestroyGarbage();
 }
 
 //-----------------------------------------------------------------------------------------------
@@ -1233,22 +1590,14 @@ void Game::SpawnEnemiesForCurrentWave()
 //-----------------------------------------------------------------------------------------------
 bool Game::AreAllEnemiesDead() const
 {
-    for (int beetleIndex = 0; beetleIndex < MAX_BEETLE_NUM; ++beetleIndex)
-    {
-        if (m_beetle[beetleIndex] && !m_beetle[beetleIndex]->IsDead()) return false;
-    }
-
-    for (int waspIndex = 0; waspIndex < MAX_WASP_NUM; ++waspIndex)
-    {
-        if (m_wasp[waspIndex] && !m_wasp[waspIndex]->IsDead()) return false;
-    }
+    bool areAllEnemiesDead = true;
 
-    for (int asteroidIndex = 0; asteroidIndex < MAX_ASTEROIDS_NUM; ++asteroidIndex)
+    m_world.ForEach<sHealth>([&areAllEnemiesDead](sHealth const& enemyHealth)
     {
-        if (m_asteroids[asteroidIndex] && !m_asteroids[asteroidIndex]->IsDead()) return false;
-    }
+        if (!enemyHealth.m_isDead) areAllEnemiesDead = false;
+    }, MakeEcsMask(eEcsComponent::TAG_ENEMY));
 
-    return true;
+    return areAllEnemiesDead;
 }
 
 void Game::DoShakeCamera(float deltaSeconds)
@@ -1268,8 +1617,9 @@ void Game::DoShakeCamera(float deltaSeconds)
         // Reset camera to base position before applying shake
         m_worldCamera->SetOrthoGraphicView(m_baseCameraPos, m_baseCameraPos + Vec2(WORLD_SIZE_X, WORLD_SIZE_Y));
 
-        // Apply the shake
+        // Apply the shake; kept so rendering culls against where the camera really is
         m_worldCamera->Translate2D(shakeOffset);
+        m_cameraShakeOffset = shakeOffset;
     }
     else
     {
@@ -1278,7 +1628,16 @@ void Game::DoShakeCamera(float deltaSeconds)
     }
 }
 
-void Game::ResetCamera() const
+void Game::ResetCamera()
+{
+    m_worldCamera->SetOrthoGraphicView(m_baseCameraPos, m_baseCameraPos + Vec2(WORLD_SIZE_X, WORLD_SIZE_Y));
+    m_cameraShakeOffset = Vec2::ZERO;
+}
+
+//----------------------------------------------------------------------------------------------------
+AABB2 Game::GetWorldCameraBounds() const
 {
-    m_worldCamera->SetOrthoGraphicView(m_baseCameraPos, m_baseCameraPos + Vec2(200.f, 100.f));
+    Vec2 const bottomLeft = m_baseCameraPos + m_cameraShakeOffset;
+
+    return AABB2(bottomLeft, bottomLeft + Vec2(WORLD_SIZE_X, WORLD_SIZE_Y));
 }
@@ -5,22 +5,44 @@
 //----------------------------------------------------------------------------------------------------
 #pragma once
 //----------------------------------------------------------------------------------------------------
-#include "Game/Asteroid.hpp"
-#include "Game/Beetle.hpp"
-#include "Game/Box.hpp"
-#include "Game/Bullet.hpp"
-#include "Game/Debris.hpp"
+#include "Game/Broadphase.hpp"
+#include "Game/CollisionCommandBuffer.hpp"
+#include "Game/EcsSystems.hpp"
+#include "Game/EcsWorld.hpp"
 #include "Game/GameCommon.hpp"
-#include "Game/PlayerShip.hpp"
-#include "Game/Wasp.hpp"
+#include "Game/PoolConfig.hpp"
+#include "Game/SweepQuery.hpp"
 //----------------------------------------------------------------------------------------------------
+#include "Engine/Audio/AudioSystem.hpp"
 #include "Engine/Core/Clock.hpp"
 #include "Engine/Core/EventSystem.hpp"
 
 //-----------------------------------------------------------------------------------------------
+class BoxWall;
 class Camera;
+class CollisionGrid;
+class DebrisSystem;
+class MeshLibrary;
+class RenderBatcher;
 class ScoreBoardHandler;
+class SweepAndPrune;
 class UIHandler;
+class WorkerPool;
+struct sBoxWallCell;
+struct sRenderBatcherStats;
+
+//-----------------------------------------------------------------------------------------------
+// Input and steering write velocities before anything integrates them
+using GameSystemList = EcsSystemList<PlayerControlSystem,
+                                     ChaseSystem,
+                                     MovementSystem,
+                                     SpinSystem,
+                                     WrapAroundSystem,
+                                     BounceOffWallsSystem,
+                                     OffScreenCullSystem>;
+
+//-----------------------------------------------------------------------------------------------
+using CollisionCommandList = std::vector<CollisionCommandBuffer>;
 
 //-----------------------------------------------------------------------------------------------
 class Game
@@ -33,30 +55,54 @@ public:
     void Render();
     void DebugRender() const;
     void ResetData();
+    void Reset(); // back to a fresh attract-mode game, reusing every allocation
     //-----------------------------------------------------------------------------------------------
     // high-level game mechanics(e.g.levels / waves, spawning)
-    void        SpawnBullet(Vec2 const& position, float orientationDegrees);
-    PlayerShip* GetPlayerShip() const;
-    void        MarkAllEntityAsDeadAndGarbage();
-    void        SetAttractMode(bool isAttractMode);
-    bool        IsAttractMode() const;
-    void        SetPlayerNameInputMode(bool isPlayerNameInputMode);
-    void        SetPlayerShipIsReadyToSpawnBullet(bool isReadyToSpawnBullet) const;
-    bool        IsPlayerNameInputMode() const;
-    int         GetHighScore() const;
+    void         SpawnBullet(Vec2 const& position, float orientationDegrees);
+    EntityHandle GetPlayerShipHandle() const;
+    int          GetPlayerScore() const;
+    void         MarkAllEntityAsDeadAndGarbage();
+    void         SetAttractMode(bool isAttractMode);
+    bool         IsAttractMode() const;
+    void         SetPlayerNameInputMode(bool isPlayerNameInputMode);
+    void         SetPlayerShipIsReadyToSpawnBullet(bool isReadyToSpawnBullet) const;
+    bool         IsPlayerNameInputMode() const;
+    int          GetHighScore() const;
+
+    // Draw calls, verts and state binds of last frame
+    sRenderBatcherStats const& GetLastFrameRenderStats() const;
+
+    // Swept-disc and ray queries against live enemies and the box wall, e.g. for beams and lines of
+    // sight. Enemies come from the broadphase, walked along the segment rather than over its bounds;
+    // those destroyed since it was last rebuilt are skipped.
+    bool SweepDiscFirstHit(sSweepQuery const& query, sSweepHit& out_hit) const;
+    void SweepDiscAllHits(sSweepQuery const& query, std::vector<sSweepHit>& out_hits) const; // nearest first
+    void SweepDiscsFirstHits(std::vector<sSweepQuery> const& queries, std::vector<sSweepHit>& out_hits) const; // one per query, NONE if it hit nothing; split over m_workerPool
+
+    // Live enemies nearest a point by center distance, e.g. for homing or picking a target. Results go
+    // to the caller's buffer nearest first, with nothing allocated; the return is how many were written.
+    int  FindNearestEnemies(Vec2 const& center, float maxDistance, int maxNeighbors, sBroadphaseNeighbor* out_neighbors) const;
+    // One query per center: query i writes out_neighbors[i * maxNeighborsPerQuery, ...) and out_numNeighbors[i]; split over m_workerPool
+    void FindNearestEnemies(Vec2 const* centers, int numQueries, float maxDistance, int maxNeighborsPerQuery, sBroadphaseNeighbor* out_neighbors, int* out_numNeighbors) const;
+    // Every live enemy centered within 'radius', unsorted; writes up to maxNeighbors and returns how many there were in all
+    int  FindEnemiesInRadius(Vec2 const& center, float radius, int maxNeighbors, sBroadphaseNeighbor* out_neighbors) const;
 
     static bool Command_SetTimeScale(EventArgs& args);
+    static bool Command_ShowEntityStats(EventArgs& args);
+    static bool Command_SetBroadphase(EventArgs& args);
+    static bool Command_SetCollisionThreads(EventArgs& args);
+    static bool Command_SweepFromPlayerShip(EventArgs& args);
+    static bool Command_ListNearestEnemies(EventArgs& args);
 
 private:
+    void RegisterArchetypes();
+    void ReportPoolBudget() const;
     void SpawnPlayerShip();
     void SpawnBeetle(Vec2 const& position);
     void SpawnWasp(Vec2 const& position);
     void SpawnAsteroid(Vec2 const& position);
-    void SpawnDebris(Vec2 const& position, Vec2 const& velocity, float radius, Rgba8 color);
     void SpawnDebrisCluster(Vec2 const& position, Vec2 const& velocity, int numDebris, float radius, Rgba8 color);
-    void SpawnBox(Vec2 const& position);
-    void SpawnBoxCluster();
-    void SpawnRandomEnemy(int boxIndex);
+    void SpawnRandomEnemy(Vec2 const& position);
     void UpdateEntities(float deltaSeconds);
     void UpdateFromKeyBoard();
     void UpdateFromController();
@@ -65,47 +111,85 @@ private:
     void DebugRenderEntities() const;
 
     // entity-vs-entity interactions (e.g. physics, damage)
-    void HandleEntityCollision();
-    void HandleCollisionBetweenPlayerShipAndBox();
-    void HandleEntityIsOffScreen() const;
+    void RebuildBroadphase();
+
+    // Enemies overlapping the disc, from whichever broadphase m_broadphase selects
+    template <typename Func>
+    void ForEachEnemyOverlap(Vec2 const& center, float radius, Func&& func) const;
+
+    // Enemies that may touch a disc swept from 'start' by 'displacement', from the same broadphase
+    template <typename Func>
+    void ForEachEnemyCandidateAlongSegment(Vec2 const& start, Vec2 const& displacement, float radius, Func&& func) const;
+
+    // 'func' is called as func(sSweepHit const&) for every live enemy and box the query touches, unsorted
+    template <typename Func>
+    void ForEachSweepHit(sSweepQuery const& query, Func&& func) const;
+
+    void HandleEntityCollision(float deltaSeconds);
+    void DetectPlayerShipHits(CollisionCommandBuffer& out_commands) const;
+    void DetectPlayerShipBoxWallHits(CollisionCommandBuffer& out_commands) const;
+    void DetectBulletHits(float deltaSeconds, int firstRow, int endRow, CollisionCommandBuffer& out_commands) const;
+    void ApplyCollisionHits();
+    void ApplyPlayerShipHitOnBox(sCollisionHit const& hit);
+    void ApplyBulletHitOnBoxWall(sCollisionHit const& hit);
+    bool ApplyDamage(sHealth& health, Vec2 const& debrisPosition, Vec2 const& debrisVelocity, Rgba8 const& color, int numDeathDebris);
+
+    // One specialization per target kind ENTITY_COLLISION_MATRIX lets the source hit
+    template <eEntityKind Target>
+    void ApplyPlayerShipHitOnEnemy(sCollisionHit const& hit);
+
+    template <eEntityKind Target>
+    void ApplyBulletHitOnEnemy(sCollisionHit const& hit);
+    void AddPlayerScore(int points) const;
+    void PlayEntityHitSound() const;
+
+    sHealth*        GetPlayerShipHealth() const;
+    sPlayerControl* GetPlayerShipControl() const;
 
     Vec2 GetOffScreenPosition(float entityCosmeticRadius) const;
 
     void DeleteGarbageEntities();
     void SpawnEnemiesForCurrentWave();
     bool AreAllEnemiesDead() const;
-    void DoShakeCamera(float deltaSeconds);
-    void ResetCamera() const;
+    void  DoShakeCamera(float deltaSeconds);
+    void  ResetCamera();
+    AABB2 GetWorldCameraBounds() const; // what the world camera shows this frame, shake included
     // bool IsAlive(Entity* entity);
     // void CheckBulletVsEnemy(Bullet& bullet, entity& enemy);
     // void CheckBulletVsEnemyList(Bullet* bullet, int listMaxSize, Entity** enemyList)
 
-    // Entity* RaycastSwampDiscVsEnemies(Vec2 const& startPos, Vec2 const& fwdNormal, float maxLength, float discRadius);
-
-    // #TODO: Entity* Lists / dynamic_cast<Asteroid*>(m_asteroid[asteroidIndex])
-    PlayerShip*        m_playerShip                   = nullptr; // Just one player ship (for now...)
-    Bullet*            m_bullets[MAX_BULLETS_NUM]     = {};      // Fixed number of asteroid �slots�; nullptr if unused.
-    Asteroid*          m_asteroids[MAX_ASTEROIDS_NUM] = {};      // The �= {};� syntax initializes the array to zeros.
-    Beetle*            m_beetle[MAX_BEETLE_NUM]       = {};
-    Wasp*              m_wasp[MAX_WASP_NUM]           = {};
-    Debris*            m_debris[MAX_DEBRIS_NUM]       = {};
-    Box*               m_boxes[MAX_BOX_NUM]           = {};
-    Camera*            m_worldCamera                  = nullptr;
-    Camera*            m_screenCamera                 = nullptr;
-    int                m_currentWave                  = 0;
-    float              m_timeSinceDeath               = 0.f;
-    int                m_playerShipHealth             = MAX_PLAYER_SHIP_HEALTH;
-    bool               m_isAttractMode                = true;
-    bool               m_isPlayerNameInputMode        = false;
-    bool               m_isHighScoreboardMode         = false;
-    bool               m_isDebugRendering             = false;
-    UIHandler*         m_theUIHandler                 = nullptr;
-    float              m_shakeIntensity               = 5.f; // Current intensity of the shake
-    float              m_shakeDuration                = 20.f;  // Time remaining for the shake
-    Vec2               m_baseCameraPos                = Vec2::ZERO;
-    float              m_accumulatedTime              = 0.f;
-    ScoreBoardHandler* m_theScoreBoardHandler         = nullptr;
-    float              m_debrisVelocityRate           = 0.5f;
-    int                m_highScore                    = 0;
-    Clock*             m_gameClock                    = nullptr;
+    sPoolCapacities         m_poolCapacities;   // read from POOL_CONFIG_PATH before anything is allocated
+    EcsWorld                m_world;
+    EntityHandle            m_playerShipHandle; // Just one player ship (for now...)
+    GameSystemList          m_systems;          // run in order every frame, after collision
+    EntityRenderSystem*     m_entityRenderSystem    = nullptr;
+    RenderBatcher*          m_renderBatcher         = nullptr; // every world-space vert of a frame, drawn a few batches at a time
+    MeshLibrary*            m_meshLibrary           = nullptr;
+    DebrisSystem*           m_debrisSystem          = nullptr;
+    BoxWall*                m_boxWall               = nullptr;
+    CollisionGrid*          m_collisionGrid         = nullptr;
+    SweepAndPrune*          m_sweepAndPrune         = nullptr;
+    eBroadphase             m_broadphase            = eBroadphase::GRID;
+    CollisionCommandList    m_collisionCommandBuffers; // one per detection task, applied in task order
+    WorkerPool*             m_workerPool            = nullptr;
+    Camera*                 m_worldCamera           = nullptr;
+    Camera*                 m_screenCamera          = nullptr;
+    int                     m_currentWave           = 0;
+    float                   m_timeSinceDeath        = 0.f;
+    int                     m_playerShipHealth      = MAX_PLAYER_SHIP_HEALTH;
+    bool                    m_isAttractMode         = true;
+    bool                    m_isPlayerNameInputMode = false;
+    bool                    m_isHighScoreboardMode  = false;
+    bool                    m_isDebugRendering      = false;
+    UIHandler*              m_theUIHandler          = nullptr;
+    float                   m_shakeIntensity        = 5.f;  // Current intensity of the shake
+    float                   m_shakeDuration         = 20.f; // Time remaining for the shake
+    Vec2                    m_baseCameraPos         = Vec2::ZERO;
+    Vec2                    m_cameraShakeOffset     = Vec2::ZERO; // added to m_baseCameraPos while shaking
+    ScoreBoardHandler*      m_theScoreBoardHandler  = nullptr;
+    float                   m_debrisVelocityRate    = 0.5f;
+    SoundID                 m_inGameBgmSound        = 0;
+    SoundID                 m_entityHitSound        = 0;
+    int                     m_highScore             = 0;
+    Clock*                  m_gameClock             = nullptr;
 };
@@ -0,0 +1,1687 @@
+//----------------------------------------------------------------------------------------------------
+// GameBenchmark.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/GameBenchmark.hpp"
+//----------------------------------------------------------------------------------------------------
+#include "Game/CollisionCommandBuffer.hpp"
+#include "Game/CollisionGrid.hpp"
+#include "Game/CollisionKernels.hpp"
+#include "Game/DebrisSystem.hpp"
+#include "Game/EcsSystems.hpp"
+#include "Game/EcsWorld.hpp"
+#include "Game/GameCommon.hpp"
+#include "Game/MeshLibrary.hpp"
+#include "Game/RenderBatcher.hpp"
+#include "Game/SlabAllocator.hpp"
+#include "Game/SweepAndPrune.hpp"
+#include "Game/SweepQuery.hpp"
+#include "Game/WorkerPool.hpp"
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Core/DevConsole.hpp"
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Core/StringUtils.hpp"
+#include "Engine/Core/Time.hpp"
+#include "Engine/Math/AABB2.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Math/RandomNumberGenerator.hpp"
+#include "Engine/Renderer/VertexUtils.hpp"
+//----------------------------------------------------------------------------------------------------
+#include <algorithm>
+#include <bit>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#if defined ERROR
+#undef ERROR
+#endif
+
+//----------------------------------------------------------------------------------------------------
+constexpr int   BENCHMARK_DEFAULT_ENTITY_NUM = 20000;
+constexpr int   BENCHMARK_DEFAULT_FRAME_NUM  = 100;
+constexpr int   BENCHMARK_DEFAULT_BULLET_NUM = MAX_BULLETS_NUM;
+constexpr int   BENCHMARK_DEFAULT_ENEMY_NUM  = 2000;
+constexpr int   BENCHMARK_DEFAULT_SHAPE_NUM  = 1024;
+constexpr int   BENCHMARK_DEFAULT_QUERY_NUM  = 2000;
+constexpr int   BENCHMARK_STRESS_ENTITY_NUM  = 20000;
+constexpr int   BENCHMARK_STRESS_FRAME_NUM   = 30;
+constexpr int   BENCHMARK_SWEEP_QUERY_NUM    = 500;
+constexpr float BENCHMARK_SWEEP_LENGTH       = 60.f;
+constexpr float BENCHMARK_SWEEP_RADIUS       = 0.5f;
+constexpr int   BENCHMARK_NEIGHBOR_NUM       = 4;
+constexpr int   BENCHMARK_MAX_NEIGHBOR_NUM   = 64;
+constexpr int   BENCHMARK_INSTANCE_FRAME_NUM = 30;
+constexpr float BENCHMARK_INSTANCE_MAX_ERROR = 1e-3f; // world units between the two paths' vert positions
+constexpr float BENCHMARK_DELTA_SECONDS      = 1.f / 60.f;
+
+//----------------------------------------------------------------------------------------------------
+// The pre-ECS layout: one polymorphic, cache-line-sized record per entity carrying every field the
+// old Entity base had, updated and queried through virtual calls.
+//
+// Padding each record out to its cache line is the point of the layout, so the warning is expected.
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable: 4324) // structure was padded due to alignment specifier
+#endif
+
+class alignas(64) LegacyEntity
+{
+public:
+    virtual ~LegacyEntity() = default;
+
+    virtual void Update(float deltaSeconds) = 0;
+
+    virtual bool IsDead() const { return m_isDead; }
+    virtual Vec2 GetPosition() const { return m_position; }
+
+protected:
+    Vec2  m_position;
+    Vec2  m_velocity;
+    float m_orientationDegrees = 0.f;
+    float m_angularVelocity    = 0.f;
+    float m_physicsRadius      = 0.f;
+    float m_cosmeticRadius     = 0.f;
+    int   m_health             = 1;
+    bool  m_isDead             = false;
+    bool  m_isGarbage          = false;
+    Rgba8 m_color;
+};
+
+class LegacyAsteroid final : public LegacyEntity
+{
+public:
+    explicit LegacyAsteroid(Vec2 const& position)
+    {
+        m_position        = position;
+        m_physicsRadius   = ASTEROID_PHYSICS_RADIUS;
+        m_cosmeticRadius  = ASTEROID_COSMETIC_RADIUS;
+        m_angularVelocity = g_rng->RollRandomFloatInRange(-200.f, 200.f);
+
+        float const rangeX = g_rng->RollRandomFloatInRange(-ASTEROID_SPEED, ASTEROID_SPEED);
+        m_velocity         = Vec2(rangeX, ASTEROID_SPEED - rangeX);
+    }
+
+    void Update(float const deltaSeconds) override
+    {
+        if (m_isDead) return;
+
+        m_position           += m_velocity * deltaSeconds;
+        m_orientationDegrees += m_angularVelocity * deltaSeconds;
+
+        if (m_position.x > WORLD_SIZE_X + m_cosmeticRadius) m_position.x = 0.f;
+        else if (m_position.x < -m_cosmeticRadius) m_position.x = WORLD_SIZE_X;
+
+        if (m_position.y > WORLD_SIZE_Y + m_cosmeticRadius) m_position.y = 0.f;
+        else if (m_position.y < -m_cosmeticRadius) m_position.y = WORLD_SIZE_Y;
+    }
+};
+
+class LegacyBullet final : public LegacyEntity
+{
+public:
+    explicit LegacyBullet(Vec2 const& position)
+    {
+        m_position      = position;
+        m_physicsRadius = BULLET_PHYSICS_RADIUS;
+        m_velocity      = Vec2::MakeFromPolarDegrees(g_rng->RollRandomFloatInRange(0.f, 360.f), BULLET_SPEED);
+    }
+
+    void Update(float const deltaSeconds) override
+    {
+        if (m_isDead) return;
+
+        m_position += m_velocity * deltaSeconds;
+    }
+};
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+//----------------------------------------------------------------------------------------------------
+static Vec2 RollRandomWorldPosition()
+{
+    return Vec2(g_rng->RollRandomFloatInRange(0.f, WORLD_SIZE_X),
+                g_rng->RollRandomFloatInRange(0.f, WORLD_SIZE_Y));
+}
+
+//----------------------------------------------------------------------------------------------------
+// Builds numEntities LegacyAsteroids in one slab, as the old entity pools did, and times numFrames of
+// Update over them through base pointers.
+//
+static double TimeLegacyUpdates(int const numEntities, int const numFrames)
+{
+    SlabAllocator<LegacyAsteroid> allocator;
+    allocator.Reserve(numEntities);
+
+    std::vector<LegacyEntity*> entities;
+    entities.reserve(numEntities);
+
+    for (int entityIndex = 0; entityIndex < numEntities; ++entityIndex)
+    {
+        entities.push_back(new (allocator.Allocate()) LegacyAsteroid(RollRandomWorldPosition()));
+    }
+
+    // One untimed frame so both runs start with the same cache state
+    for (LegacyEntity* entity : entities)
+    {
+        entity->Update(BENCHMARK_DELTA_SECONDS);
+    }
+
+    double const startSeconds = GetCurrentTimeSeconds();
+
+    for (int frameIndex = 0; frameIndex < numFrames; ++frameIndex)
+    {
+        for (LegacyEntity* entity : entities)
+        {
+            entity->Update(BENCHMARK_DELTA_SECONDS);
+        }
+    }
+
+    double const elapsedSeconds = GetCurrentTimeSeconds() - startSeconds;
+
+    for (LegacyEntity* entity : entities)
+    {
+        entity->~LegacyEntity();
+        allocator.Free(entity);
+    }
+
+    return elapsedSeconds;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Same simulation on a standalone EcsWorld: the movement, spin and wrap-around systems the game runs
+// over its asteroid archetype.
+//
+static double TimeEcsUpdates(int const numEntities, int const numFrames, int& out_rowsPerChunk)
+{
+    EcsWorld world;
+    world.RegisterArchetype(eEntityKind::ASTEROID, ECS_ARCHETYPE_MASKS[static_cast<int>(eEntityKind::ASTEROID)], numEntities);
+
+    for (int entityIndex = 0; entityIndex < numEntities; ++entityIndex)
+    {
+        EntityHandle const handle = world.Spawn(eEntityKind::ASTEROID);
+        float const        rangeX = g_rng->RollRandomFloatInRange(-ASTEROID_SPEED, ASTEROID_SPEED);
+
+        world.Get<sTransform>(handle)->m_position = RollRandomWorldPosition();
+        *world.Get<sVelocity>(handle)             = {Vec2(rangeX, ASTEROID_SPEED - rangeX)};
+        *world.Get<sSpin>(handle)                 = {g_rng->RollRandomFloatInRange(-200.f, 200.f)};
+        *world.Get<sCollider>(handle)             = {ASTEROID_PHYSICS_RADIUS, ASTEROID_COSMETIC_RADIUS};
+    }
+
+    out_rowsPerChunk = world.GetArchetype(eEntityKind::ASTEROID).GetRowsPerChunk();
+
+    MovementSystem   movementSystem;
+    SpinSystem       spinSystem;
+    WrapAroundSystem wrapAroundSystem;
+
+    auto const runFrame = [&]()
+    {
+        movementSystem.Update(world, BENCHMARK_DELTA_SECONDS);
+        spinSystem.Update(world, BENCHMARK_DELTA_SECONDS);
+        wrapAroundSystem.Update(world, BENCHMARK_DELTA_SECONDS);
+    };
+
+    // One untimed frame so both runs start with the same cache state
+    runFrame();
+
+    double const startSeconds = GetCurrentTimeSeconds();
+
+    for (int frameIndex = 0; frameIndex < numFrames; ++frameIndex)
+    {
+        runFrame();
+    }
+
+    return GetCurrentTimeSeconds() - startSeconds;
+}
+
+//----------------------------------------------------------------------------------------------------
+// 'findNearest' is called as findNearest(Vec2 const& center, sBroadphaseNeighbor* out_neighbors) and
+// returns how many it wrote; query i gets out_neighbors[i * numNeighbors, ...).
+//
+template <typename FindNearest>
+static double TimeNearestNeighborQueries(std::vector<Vec2> const& centers, int const numNeighbors,
+                                         std::vector<sBroadphaseNeighbor>& out_neighbors, std::vector<int>& out_counts, FindNearest&& findNearest)
+{
+    double const startSeconds = GetCurrentTimeSeconds();
+
+    for (size_t queryIndex = 0; queryIndex < centers.size(); ++queryIndex)
+    {
+        out_counts[queryIndex] = findNearest(centers[queryIndex], out_neighbors.data() + queryIndex * numNeighbors);
+    }
+
+    return GetCurrentTimeSeconds() - startSeconds;
+}
+
+//----------------------------------------------------------------------------------------------------
+// The old bullets-vs-enemy loops: every pair costs two IsDead and two GetPosition virtual calls.
+// Entities are never killed so every frame does the same work; overlaps are counted so the loop
+// cannot be optimized away.
+//
+static double TimeLegacyCollision(int const numBullets, int const numEnemies, int const numFrames, int& out_numOverlaps)
+{
+    SlabAllocator<LegacyBullet>   bulletAllocator;
+    SlabAllocator<LegacyAsteroid> enemyAllocator;
+    bulletAllocator.Reserve(numBullets);
+    enemyAllocator.Reserve(numEnemies);
+
+    std::vector<LegacyEntity*> bullets;
+    std::vector<LegacyEntity*> enemies;
+    bullets.reserve(numBullets);
+    enemies.reserve(numEnemies);
+
+    for (int bulletIndex = 0; bulletIndex < numBullets; ++bulletIndex)
+    {
+        bullets.push_back(new (bulletAllocator.Allocate()) LegacyBullet(RollRandomWorldPosition()));
+    }
+
+    for (int enemyIndex = 0; enemyIndex < numEnemies; ++enemyIndex)
+    {
+        enemies.push_back(new (enemyAllocator.Allocate()) LegacyAsteroid(RollRandomWorldPosition()));
+    }
+
+    int numOverlaps = 0;
+
+    auto const runFrame = [&]()
+    {
+        for (LegacyEntity const* bullet : bullets)
+        {
+            for (LegacyEntity const* enemy : enemies)
+            {
+                if (bullet->IsDead() || enemy->IsDead()) continue;
+
+                if (DoDiscsOverlap2D(bullet->GetPosition(), BULLET_PHYSICS_RADIUS, enemy->GetPosition(), ASTEROID_PHYSICS_RADIUS))
+                {
+                    ++numOverlaps;
+                }
+            }
+        }
+    };
+
+    // One untimed frame so both runs start with the same cache state
+    runFrame();
+    numOverlaps = 0;
+
+    double const startSeconds = GetCurrentTimeSeconds();
+
+    for (int frameIndex = 0; frameIndex < numFrames; ++frameIndex)
+    {
+        runFrame();
+    }
+
+    double const elapsedSeconds = GetCurrentTimeSeconds() - startSeconds;
+
+    for (LegacyEntity* bullet : bullets)
+    {
+        bullet->~LegacyEntity();
+        bulletAllocator.Free(bullet);
+    }
+
+    for (LegacyEntity* enemy : enemies)
+    {
+        enemy->~LegacyEntity();
+        enemyAllocator.Free(enemy);
+    }
+
+    out_numOverlaps = numOverlaps;
+
+    return elapsedSeconds;
+}
+
+//----------------------------------------------------------------------------------------------------
+// The same pairs through the ECS queries Game::HandleEntityCollision uses: the per-row kernels are
+// lambdas bound at compile time, so the inner loop makes no indirect calls.
+//
+static double TimeEcsCollision(int const numBullets, int const numEnemies, int const numFrames, int& out_numOverlaps)
+{
+    EcsWorld world;
+    world.RegisterArchetype(eEntityKind::BULLET, ECS_ARCHETYPE_MASKS[static_cast<int>(eEntityKind::BULLET)], numBullets);
+    world.RegisterArchetype(eEntityKind::ASTEROID, ECS_ARCHETYPE_MASKS[static_cast<int>(eEntityKind::ASTEROID)], numEnemies);
+
+    for (int bulletIndex = 0; bulletIndex < numBullets; ++bulletIndex)
+    {
+        EntityHandle const handle = world.Spawn(eEntityKind::BULLET);
+
+        world.Get<sTransform>(handle)->m_position = RollRandomWorldPosition();
+        *world.Get<sCollider>(handle)             = {BULLET_PHYSICS_RADIUS, BULLET_COSMETIC_RADIUS};
+    }
+
+    for (int enemyIndex = 0; enemyIndex < numEnemies; ++enemyIndex)
+    {
+        EntityHandle const handle = world.Spawn(eEntityKind::ASTEROID);
+
+        world.Get<sTransform>(handle)->m_position = RollRandomWorldPosition();
+        *world.Get<sCollider>(handle)             = {ASTEROID_PHYSICS_RADIUS, ASTEROID_COSMETIC_RADIUS};
+    }
+
+    int numOverlaps = 0;
+
+    auto const runFrame = [&]()
+    {
+        world.ForEachOfKind<sTransform, sHealth>(eEntityKind::BULLET, [&](sTransform const& bulletTransform, sHealth const& bulletHealth)
+        {
+            world.ForEach<sTransform, sHealth, sCollider>([&](sTransform const& enemyTransform, sHealth const& enemyHealth, sCollider const& enemyCollider)
+            {
+                if (bulletHealth.m_isDead || enemyHealth.m_isDead) return;
+
+                if (DoDiscsOverlap2D(bulletTransform.m_position, BULLET_PHYSICS_RADIUS, enemyTransform.m_position, enemyCollider.m_physicsRadius))
+                {
+                    ++numOverlaps;
+                }
+            }, MakeEcsMask(eEcsComponent::TAG_ENEMY));
+        });
+    };
+
+    // One untimed frame so both runs start with the same cache state
+    runFrame();
+    numOverlaps = 0;
+
+    double const startSeconds = GetCurrentTimeSeconds();
+
+    for (int frameIndex = 0; frameIndex < numFrames; ++frameIndex)
+    {
+        runFrame();
+    }
+
+    out_numOverlaps = numOverlaps;
+
+    return GetCurrentTimeSeconds() - startSeconds;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Packed shapes and query points for the kernel self-check and benchmark. Shape 0 is exactly tangent
+// to query 0 and box 0 has query 0 on its left edge, so the strict-inequality rule is exercised too.
+//
+struct sKernelBenchmarkData
+{
+    std::vector<float> m_centersX;
+    std::vector<float> m_centersY;
+    std::vector<float> m_radii;
+    std::vector<float> m_minsX;
+    std::vector<float> m_minsY;
+    std::vector<float> m_maxsX;
+    std::vector<float> m_maxsY;
+    std::vector<Vec2>  m_queries;
+};
+
+static sKernelBenchmarkData MakeKernelBenchmarkData(int const numShapes, int const numQueries)
+{
+    sKernelBenchmarkData data;
+
+    for (int shapeIndex = 0; shapeIndex < numShapes; ++shapeIndex)
+    {
+        Vec2 const  center = RollRandomWorldPosition();
+        Vec2 const  mins   = RollRandomWorldPosition();
+        float const radius = g_rng->RollRandomFloatInRange(BULLET_PHYSICS_RADIUS, ASTEROID_COSMETIC_RADIUS);
+
+        data.m_centersX.push_back(center.x);
+        data.m_centersY.push_back(center.y);
+        data.m_radii.push_back(radius);
+        data.m_minsX.push_back(mins.x);
+        data.m_minsY.push_back(mins.y);
+        data.m_maxsX.push_back(mins.x + BOX_SIDE_LENGTH * 4.f);
+        data.m_maxsY.push_back(mins.y + BOX_SIDE_LENGTH * 4.f);
+    }
+
+    for (int queryIndex = 0; queryIndex < numQueries; ++queryIndex)
+    {
+        data.m_queries.push_back(RollRandomWorldPosition());
+    }
+
+    // 3-4-5 triangle: squared distance 25.0 equals the squared radius sum exactly
+    data.m_queries[0]  = Vec2(10.f, 10.f);
+    data.m_centersX[0] = 13.f;
+    data.m_centersY[0] = 14.f;
+    data.m_radii[0]    = 5.f - BULLET_PHYSICS_RADIUS;
+    data.m_minsX[0]    = 10.f;
+    data.m_minsY[0]    = 5.f;
+    data.m_maxsX[0]    = 20.f;
+    data.m_maxsY[0]    = 15.f;
+
+    return data;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Moving enemies and bullets for the broadphase benchmark; both broadphases replay the same copy.
+//
+enum class eBroadphaseScene : uint8_t
+{
+    DRIFT,   // everything scrolls left at similar speeds, like the box wall and the asteroid field
+    SWARM,   // uniform positions, random headings
+    CLUSTER, // a dense knot in the middle of the world
+    NUM
+};
+
+static char const* const BROADPHASE_SCENE_NAMES[] = {"drift", "swarm", "cluster"};
+
+struct sBroadphaseScene
+{
+    std::vector<Vec2>  m_enemyPositions;
+    std::vector<Vec2>  m_enemyVelocities;
+    std::vector<float> m_enemyRadii;
+    std::vector<Vec2>  m_bulletPositions;
+    std::vector<Vec2>  m_bulletVelocities;
+};
+
+struct sBroadphaseTiming
+{
+    double m_buildSeconds  = 0.0;
+    double m_querySeconds  = 0.0;
+    int    m_numCandidates = 0;
+    int    m_numOverlaps   = 0;
+    int    m_numSortShifts = 0; // SweepAndPrune only
+};
+
+static sBroadphaseScene MakeBroadphaseScene(eBroadphaseScene const sceneType, int const numEnemies, int const numBullets)
+{
+    float const      enemyRadii[] = {ASTEROID_PHYSICS_RADIUS, BEETLE_PHYSICS_RADIUS, WASP_PHYSICS_RADIUS};
+    sBroadphaseScene scene;
+
+    for (int enemyIndex = 0; enemyIndex < numEnemies; ++enemyIndex)
+    {
+        Vec2 position;
+        Vec2 velocity;
+
+        switch (sceneType)
+        {
+        case eBroadphaseScene::DRIFT:
+            position = RollRandomWorldPosition();
+            velocity = Vec2(-g_rng->RollRandomFloatInRange(4.f, 6.f), g_rng->RollRandomFloatInRange(-0.5f, 0.5f));
+            break;
+        case eBroadphaseScene::SWARM:
+            position = RollRandomWorldPosition();
+            velocity = Vec2::MakeFromPolarDegrees(g_rng->RollRandomFloatInRange(0.f, 360.f), g_rng->RollRandomFloatInRange(2.f, 8.f));
+            break;
+        default:
+            position = Vec2(WORLD_SIZE_X * 0.5f + g_rng->RollRandomFloatInRange(-15.f, 15.f),
+                            WORLD_SIZE_Y * 0.5f + g_rng->RollRandomFloatInRange(-8.f, 8.f));
+            velocity = Vec2::MakeFromPolarDegrees(g_rng->RollRandomFloatInRange(0.f, 360.f), g_rng->RollRandomFloatInRange(0.5f, 1.f));
+            break;
+        }
+
+        scene.m_enemyPositions.push_back(position);
+        scene.m_enemyVelocities.push_back(velocity);
+        scene.m_enemyRadii.push_back(enemyRadii[enemyIndex % 3]);
+    }
+
+    for (int bulletIndex = 0; bulletIndex < numBullets; ++bulletIndex)
+    {
+        scene.m_bulletPositions.push_back(RollRandomWorldPosition());
+        scene.m_bulletVelocities.push_back(Vec2::MakeFromPolarDegrees(g_rng->RollRandomFloatInRange(-20.f, 20.f), BULLET_SPEED));
+    }
+
+    return scene;
+}
+
+static void StepAndWrapPositions(std::vector<Vec2>& positions, std::vector<Vec2> const& velocities)
+{
+    for (size_t index = 0; index < positions.size(); ++index)
+    {
+        Vec2& position = positions[index];
+
+        position += velocities[index] * BENCHMARK_DELTA_SECONDS;
+
+        if (position.x < 0.f) position.x += WORLD_SIZE_X;
+        if (position.x > WORLD_SIZE_X) position.x -= WORLD_SIZE_X;
+        if (position.y < 0.f) position.y += WORLD_SIZE_Y;
+        if (position.y > WORLD_SIZE_Y) position.y -= WORLD_SIZE_Y;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// The per-frame work Game::HandleEntityCollision gives a broadphase: rebuild from every enemy, then
+// one overlap query per bullet. Works with anything shaped like CollisionGrid.
+//
+template <typename Broadphase>
+static sBroadphaseTiming TimeBroadphase(Broadphase& broadphase, sBroadphaseScene scene, int const numFrames)
+{
+    sBroadphaseTiming timing;
+
+    for (int frameIndex = 0; frameIndex < numFrames; ++frameIndex)
+    {
+        StepAndWrapPositions(scene.m_enemyPositions, scene.m_enemyVelocities);
+        StepAndWrapPositions(scene.m_bulletPositions, scene.m_bulletVelocities);
+
+        double const buildStartSeconds = GetCurrentTimeSeconds();
+
+        broadphase.Clear();
+
+        for (int enemyIndex = 0; enemyIndex < static_cast<int>(scene.m_enemyPositions.size()); ++enemyIndex)
+        {
+            broadphase.Insert({scene.m_enemyPositions[enemyIndex], scene.m_enemyRadii[enemyIndex], EntityHandle(enemyIndex, 0), eEntityKind::ASTEROID});
+        }
+
+        broadphase.Build();
+
+        double const queryStartSeconds = GetCurrentTimeSeconds();
+
+        for (Vec2 const& bulletPosition : scene.m_bulletPositions)
+        {
+            broadphase.ForEachOverlap(bulletPosition, BULLET_PHYSICS_RADIUS, [&timing](sBroadphaseEntry const&)
+            {
+                ++timing.m_numOverlaps;
+            });
+        }
+
+        double const endSeconds = GetCurrentTimeSeconds();
+
+        timing.m_buildSeconds  += queryStartSeconds - buildStartSeconds;
+        timing.m_querySeconds  += endSeconds - queryStartSeconds;
+        timing.m_numCandidates += broadphase.GetNumCandidatesVisited();
+
+        if constexpr (requires { broadphase.GetNumSortShifts(); })
+        {
+            timing.m_numSortShifts += broadphase.GetNumSortShifts();
+        }
+    }
+
+    return timing;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Game::DetectBulletHits without the box wall: sweep each bullet in [firstBullet, endBullet) over its
+// step and record the first enemy it reaches.
+//
+static void DetectSceneBulletHits(CollisionGrid const& grid, sBroadphaseScene const& scene, int const firstBullet, int const endBullet, CollisionCommandBuffer& out_commands)
+{
+    for (int bulletIndex = firstBullet; bulletIndex < endBullet; ++bulletIndex)
+    {
+        Vec2 const start        = scene.m_bulletPositions[bulletIndex];
+        Vec2 const displacement = scene.m_bulletVelocities[bulletIndex] * BENCHMARK_DELTA_SECONDS;
+
+        sCollisionHit hit;
+        float         enemyHitFraction = 1.f;
+
+        grid.ForEachOverlap(start + displacement * 0.5f, displacement.GetLength() * 0.5f + BULLET_PHYSICS_RADIUS, [&](sBroadphaseEntry const& enemy)
+        {
+            float hitFraction;
+
+            if (!SweepDiscAgainstDisc(start, displacement, BULLET_PHYSICS_RADIUS, enemy.m_center, enemy.m_radius, hitFraction)) return;
+            if (hit.m_target.IsValid() && hitFraction >= enemyHitFraction) return;
+
+            hit.m_target     = enemy.m_handle;
+            enemyHitFraction = hitFraction;
+        });
+
+        if (!hit.m_target.IsValid()) continue;
+
+        hit.m_kind     = eCollisionHitKind::BULLET_VS_ENEMY;
+        hit.m_source   = EntityHandle(bulletIndex, 0);
+        hit.m_position = start + displacement * enemyHitFraction;
+
+        out_commands.Push(hit);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// FNV-1a over the merged hits, so runs on different thread counts can be compared exactly
+//
+static uint64_t HashCollisionHits(uint64_t hash, std::vector<CollisionCommandBuffer> const& buffers)
+{
+    for (CollisionCommandBuffer const& commands : buffers)
+    {
+        for (sCollisionHit const& hit : commands.GetHits())
+        {
+            uint32_t positionBits[2];
+            std::memcpy(positionBits, &hit.m_position, sizeof(positionBits));
+
+            uint32_t const words[] = {hit.m_source.m_data, hit.m_target.m_data, positionBits[0], positionBits[1]};
+
+            for (uint32_t const word : words)
+            {
+                hash = (hash ^ word) * 1099511628211ull;
+            }
+        }
+    }
+
+    return hash;
+}
+
+//----------------------------------------------------------------------------------------------------
+// The first enemy a sweep reaches, as an index into the scene
+//
+struct sSweepBenchmarkHit
+{
+    int   m_enemyIndex  = -1;
+    float m_hitFraction = 1.f;
+};
+
+// Ties keep the lower index, so every way of finding candidates settles on the same enemy
+static void KeepFirstSweepHit(sSweepQuery const& query, sBroadphaseEntry const& enemy, sSweepBenchmarkHit& hit)
+{
+    float hitFraction;
+
+    if (!SweepDiscAgainstDisc(query.m_start, query.m_direction * query.m_maxLength, query.m_radius, enemy.m_center, enemy.m_radius, hitFraction)) return;
+
+    int const enemyIndex = enemy.m_handle.GetIndex();
+
+    if (hit.m_enemyIndex >= 0 && (hitFraction > hit.m_hitFraction || (hitFraction == hit.m_hitFraction && enemyIndex > hit.m_enemyIndex))) return;
+
+    hit.m_enemyIndex  = enemyIndex;
+    hit.m_hitFraction = hitFraction;
+}
+
+//----------------------------------------------------------------------------------------------------
+// 'visitCandidates' is called as visitCandidates(sSweepQuery const&, func) and hands func every
+// enemy it considers for that query.
+//
+template <typename VisitCandidates>
+static double TimeSweepQueries(std::vector<sSweepQuery> const& queries, std::vector<sSweepBenchmarkHit>& out_hits, VisitCandidates&& visitCandidates)
+{
+    double const startSeconds = GetCurrentTimeSeconds();
+
+    for (size_t queryIndex = 0; queryIndex < queries.size(); ++queryIndex)
+    {
+        sSweepQuery const& query = queries[queryIndex];
+        sSweepBenchmarkHit hit;
+
+        visitCandidates(query, [&query, &hit](sBroadphaseEntry const& enemy)
+        {
+            KeepFirstSweepHit(query, enemy, hit);
+        });
+
+        out_hits[queryIndex] = hit;
+    }
+
+    return GetCurrentTimeSeconds() - startSeconds;
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC bool GameBenchmark::Command_RunEntityUpdateBenchmark(EventArgs& args)
+{
+    int const numEntities = args.GetValue("entities", BENCHMARK_DEFAULT_ENTITY_NUM);
+    int const numFrames   = args.GetValue("frames", BENCHMARK_DEFAULT_FRAME_NUM);
+
+    if (numEntities <= 0 || numFrames <= 0 || numEntities > static_cast<int>(EntityHandle::INDEX_MASK))
+    {
+        g_devConsole->AddLine(DevConsole::ERROR, "Usage: benchmark entities=PositiveInt frames=PositiveInt");
+        return false;
+    }
+
+    RunEntityUpdateBenchmark(numEntities, numFrames);
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC void GameBenchmark::RunEntityUpdateBenchmark(int const numEntities, int const numFrames)
+{
+    int          rowsPerChunk  = 0;
+    double const legacySeconds = TimeLegacyUpdates(numEntities, numFrames);
+    double const ecsSeconds    = TimeEcsUpdates(numEntities, numFrames, rowsPerChunk);
+    double const numUpdates    = static_cast<double>(numEntities) * static_cast<double>(numFrames);
+
+    g_devConsole->AddLine(DevConsole::INFO_MAJOR,
+                          Stringf("Asteroid Update benchmark: %d entities x %d frames", numEntities, numFrames));
+    g_devConsole->AddLine(DevConsole::INFO_MINOR,
+                          Stringf("  virtual AoS    %5d bytes/entity  %8.3f ms/frame  %6.2f ns/update  %8d indirect calls/frame",
+                                  static_cast<int>(sizeof(LegacyAsteroid)),
+                                  legacySeconds * 1000.0 / numFrames,
+                                  legacySeconds * 1.0e9 / numUpdates,
+                                  numEntities));
+    g_devConsole->AddLine(DevConsole::INFO_MINOR,
+                          Stringf("  ECS chunks     %5d rows/chunk    %8.3f ms/frame  %6.2f ns/update  %8d indirect calls/frame",
+                                  rowsPerChunk,
+                                  ecsSeconds * 1000.0 / numFrames,
+                                  ecsSeconds * 1.0e9 / numUpdates,
+                                  0));
+    g_devConsole->AddLine(DevConsole::INFO_MINOR,
+                          Stringf("  speedup        %.2fx", ecsSeconds > 0.0 ? legacySeconds / ecsSeconds : 0.0));
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC bool GameBenchmark::Command_RunCollisionDispatchBenchmark(EventArgs& args)
+{
+    int const numBullets = args.GetValue("bullets", BENCHMARK_DEFAULT_BULLET_NUM);
+    int const numEnemies = args.GetValue("enemies", BENCHMARK_DEFAULT_ENEMY_NUM);
+    int const numFrames  = args.GetValue("frames", BENCHMARK_DEFAULT_FRAME_NUM);
+
+    if (numBullets <= 0 || numEnemies <= 0 || numFrames <= 0 ||
+        numBullets + numEnemies > static_cast<int>(EntityHandle::INDEX_MASK))
+    {
+        g_devConsole->AddLine(DevConsole::ERROR, "Usage: benchmarkcollision bullets=PositiveInt enemies=PositiveInt frames=PositiveInt");
+        return false;
+    }
+
+    RunCollisionDispatchBenchmark(numBullets, numEnemies, numFrames);
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Branch misses cannot be read from here; the indirect-call counts are what each layout issues per
+// frame, and every one of them is an indirect branch the predictor has to track.
+//
+STATIC void GameBenchmark::RunCollisionDispatchBenchmark(int const numBullets, int const numEnemies, int const numFrames)
+{
+    int          legacyOverlaps = 0;
+    int          ecsOverlaps    = 0;
+    double const legacySeconds  = TimeLegacyCollision(numBullets, numEnemies, numFrames, legacyOverlaps);
+    double const ecsSeconds     = TimeEcsCollision(numBullets, numEnemies, numFrames, ecsOverlaps);
+    double const numPairs       = static_cast<double>(numBullets) * static_cast<double>(numEnemies) * static_cast<double>(numFrames);
+
+    g_devConsole->AddLine(DevConsole::INFO_MAJOR,
+                          Stringf("Bullet vs. enemy collision benchmark: %d x %d pairs x %d frames", numBullets, numEnemies, numFrames));
+    g_devConsole->AddLine(DevConsole::INFO_MINOR,
+                          Stringf("  virtual AoS    %8.3f ms/frame  %6.2f ns/pair  %10d indirect calls/frame  %d overlaps",
+                                  legacySeconds * 1000.0 / numFrames,
+                                  legacySeconds * 1.0e9 / numPairs,
+                                  4 * numBullets * numEnemies,
+                                  legacyOverlaps / numFrames));
+    g_devConsole->AddLine(DevConsole::INFO_MINOR,
+                          Stringf("  ECS queries    %8.3f ms/frame  %6.2f ns/pair  %10d indirect calls/frame  %d overlaps",
+                                  ecsSeconds * 1000.0 / numFrames,
+                                  ecsSeconds * 1.0e9 / numPairs,
+                                  0,
+                                  ecsOverlaps / numFrames));
+    g_devConsole->AddLine(DevConsole::INFO_MINOR,
+                          Stringf("  speedup        %.2fx", ecsSeconds > 0.0 ? legacySeconds / ecsSeconds : 0.0));
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC bool GameBenchmark::Command_RunCollisionKernelBenchmark(EventArgs& args)
+{
+    int const numShapes  = args.GetValue("shapes", BENCHMARK_DEFAULT_SHAPE_NUM);
+    int const numQueries = args.GetValue("queries", BENCHMARK_DEFAULT_QUERY_NUM);
+
+    if (numShapes <= 0 || numQueries <= 0)
+    {
+        g_devConsole->AddLine(DevConsole::ERROR, "Usage: benchmarkkernels shapes=PositiveInt queries=PositiveInt");
+        return false;
+    }
+
+    if (!RunCollisionKernelSelfCheck(numShapes, numQueries)) return false;
+
+    RunCollisionKernelBenchmark(numShapes, numQueries);
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Every supported path must produce the scalar path's masks bit for bit, and the scalar path must
+// agree with DoDiscsOverlap2D and AABB2::IsPointInside on every pair.
+//
+STATIC bool GameBenchmark::RunCollisionKernelSelfCheck(int const numShapes, int const numQueries)
+{
+    sKernelBenchmarkData const data         = MakeKernelBenchmarkData(numShapes, numQueries);
+    eCollisionKernelPath const originalPath = GetCollisionKernelPath();
+    int const                  numWords     = GetCollisionHitMaskWords(numShapes);
+
+    std::vector<uint32_t> scalarDiscMasks(static_cast<size_t>(numWords) * numQueries);
+    std::vector<uint32_t> scalarPointMasks(static_cast<size_t>(numWords) * numQueries);
+    std::vector<uint32_t> masks(numWords);
+    int                   numEngineMismatches = 0;
+
+    SetCollisionKernelPath(eCollisionKernelPath::SCALAR);
+
+    for (int queryIndex = 0; queryIndex < numQueries; ++queryIndex)
+    {
+        Vec2 const query      = data.m_queries[queryIndex];
+        uint32_t*  discMasks  = scalarDiscMasks.data() + static_cast<size_t>(queryIndex) * numWords;
+        uint32_t*  pointMasks = scalarPointMasks.data() + static_cast<size_t>(queryIndex) * numWords;
+
+        FindDiscsOverlappingDisc(query, BULLET_PHYSICS_RADIUS, data.m_centersX.data(), data.m_centersY.data(), data.m_radii.data(), numShapes, discMasks);
+        FindAABBsContainingPoint(query, data.m_minsX.data(), data.m_minsY.data(), data.m_maxsX.data(), data.m_maxsY.data(), numShapes, pointMasks);
+
+        for (int shapeIndex = 0; shapeIndex < numShapes; ++shapeIndex)
+        {
+            uint32_t const bit         = 1u << (shapeIndex & 31);
+            bool const     kernelDisc  = (discMasks[shapeIndex >> 5] & bit) != 0;
+            bool const     kernelPoint = (pointMasks[shapeIndex >> 5] & bit) != 0;
+            bool const     engineDisc  = DoDiscsOverlap2D(query, BULLET_PHYSICS_RADIUS,
+                                                          Vec2(data.m_centersX[shapeIndex], data.m_centersY[shapeIndex]),
+                                                          data.m_radii[shapeIndex]);
+            bool const     enginePoint = AABB2(Vec2(data.m_minsX[shapeIndex], data.m_minsY[shapeIndex]),
+                                               Vec2(data.m_maxsX[shapeIndex], data.m_maxsY[shapeIndex])).IsPointInside(query);
+
+            if (kernelDisc != engineDisc) ++numEngineMismatches;
+            if (kernelPoint != enginePoint) ++numEngineMismatches;
+        }
+    }
+
+    bool isPassing = numEngineMismatches == 0;
+
+    g_devConsole->AddLine(isPassing ? DevConsole::INFO_MINOR : DevConsole::ERROR,
+                          Stringf("  self-check scalar vs. engine    %d mismatches", numEngineMismatches));
+
+    for (int pathIndex = static_cast<int>(eCollisionKernelPath::SSE2); pathIndex < static_cast<int>(eCollisionKernelPath::NUM); ++pathIndex)
+    {
+        eCollisionKernelPath const path = static_cast<eCollisionKernelPath>(pathIndex);
+
+        if (!IsCollisionKernelPathSupported(path)) continue;
+
+        SetCollisionKernelPath(path);
+
+        int numPathMismatches = 0;
+
+        for (int queryIndex = 0; queryIndex < numQueries; ++queryIndex)
+        {
+            Vec2 const      query      = data.m_queries[queryIndex];
+            uint32_t const* discMasks  = scalarDiscMasks.data() + static_cast<size_t>(queryIndex) * numWords;
+            uint32_t const* pointMasks = scalarPointMasks.data() + static_cast<size_t>(queryIndex) * numWords;
+
+            FindDiscsOverlappingDisc(query, BULLET_PHYSICS_RADIUS, data.m_centersX.data(), data.m_centersY.data(), data.m_radii.data(), numShapes, masks.data());
+
+            for (int wordIndex = 0; wordIndex < numWords; ++wordIndex)
+            {
+                if (masks[wordIndex] != discMasks[wordIndex]) ++numPathMismatches;
+            }
+
+            FindAABBsContainingPoint(query, data.m_minsX.data(), data.m_minsY.data(), data.m_maxsX.data(), data.m_maxsY.data(), numShapes, masks.data());
+
+            for (int wordIndex = 0; wordIndex < numWords; ++wordIndex)
+            {
+                if (masks[wordIndex] != pointMasks[wordIndex]) ++numPathMismatches;
+            }
+        }
+
+        isPassing = isPassing && numPathMismatches == 0;
+
+        g_devConsole->AddLine(numPathMismatches == 0 ? DevConsole::INFO_MINOR : DevConsole::ERROR,
+                              Stringf("  self-check %-6s vs. scalar      %d mismatched mask words", GetCollisionKernelPathName(path), numPathMismatches));
+    }
+
+    SetCollisionKernelPath(originalPath);
+
+    return isPassing;
+}
+
+//----------------------------------------------------------------------------------------------------
+// One query against all shapes per call, i.e. the shape of a crowded grid cell or box wall column
+// scaled up; the engine row is the pair-at-a-time loop the kernels replace.
+//
+STATIC void GameBenchmark::RunCollisionKernelBenchmark(int const numShapes, int const numQueries)
+{
+    sKernelBenchmarkData const data         = MakeKernelBenchmarkData(numShapes, numQueries);
+    eCollisionKernelPath const originalPath = GetCollisionKernelPath();
+    double const               numTests     = static_cast<double>(numShapes) * static_cast<double>(numQueries);
+
+    std::vector<uint32_t> masks(GetCollisionHitMaskWords(numShapes));
+
+    g_devConsole->AddLine(DevConsole::INFO_MAJOR,
+                          Stringf("Collision kernel benchmark: %d shapes x %d queries (active path %s)",
+                                  numShapes, numQueries, GetCollisionKernelPathName(originalPath)));
+
+    int    numEngineHits = 0;
+    double startSeconds  = GetCurrentTimeSeconds();
+
+    for (Vec2 const& query : data.m_queries)
+    {
+        for (int shapeIndex = 0; shapeIndex < numShapes; ++shapeIndex)
+        {
+            if (DoDiscsOverlap2D(query, BULLET_PHYSICS_RADIUS, Vec2(data.m_centersX[shapeIndex], data.m_centersY[shapeIndex]), data.m_radii[shapeIndex]))
+            {
+                ++numEngineHits;
+            }
+        }
+    }
+
+    double const engineDiscSeconds = GetCurrentTimeSeconds() - startSeconds;
+
+    startSeconds = GetCurrentTimeSeconds();
+
+    for (Vec2 const& query : data.m_queries)
+    {
+        for (int shapeIndex = 0; shapeIndex < numShapes; ++shapeIndex)
+        {
+            if (AABB2(Vec2(data.m_minsX[shapeIndex], data.m_minsY[shapeIndex]), Vec2(data.m_maxsX[shapeIndex], data.m_maxsY[shapeIndex])).IsPointInside(query))
+            {
+                ++numEngineHits;
+            }
+        }
+    }
+
+    double const enginePointSeconds = GetCurrentTimeSeconds() - startSeconds;
+
+    g_devConsole->AddLine(DevConsole::INFO_MINOR,
+                          Stringf("  engine pairs   disc %6.2f ns/test  point %6.2f ns/test  %d hits",
+                                  engineDiscSeconds * 1.0e9 / numTests,
+                                  enginePointSeconds * 1.0e9 / numTests,
+                                  numEngineHits));
+
+    for (int pathIndex = 0; pathIndex < static_cast<int>(eCollisionKernelPath::NUM); ++pathIndex)
+    {
+        eCollisionKernelPath const path = static_cast<eCollisionKernelPath>(pathIndex);
+
+        if (!IsCollisionKernelPathSupported(path)) continue;
+
+        SetCollisionKernelPath(path);
+
+        int numHits = 0;
+
+        startSeconds = GetCurrentTimeSeconds();
+
+        for (Vec2 const& query : data.m_queries)
+        {
+            FindDiscsOverlappingDisc(query, BULLET_PHYSICS_RADIUS, data.m_centersX.data(), data.m_centersY.data(), data.m_radii.data(), numShapes, masks.data());
+            numHits += std::popcount(masks[0]);
+        }
+
+        double const discSeconds = GetCurrentTimeSeconds() - startSeconds;
+
+        startSeconds = GetCurrentTimeSeconds();
+
+        for (Vec2 const& query : data.m_queries)
+        {
+            FindAABBsContainingPoint(query, data.m_minsX.data(), data.m_minsY.data(), data.m_maxsX.data(), data.m_maxsY.data(), numShapes, masks.data());
+            numHits += std::popcount(masks[0]);
+        }
+
+        double const pointSeconds = GetCurrentTimeSeconds() - startSeconds;
+
+        // Hits in the first mask word only, which keeps the loops from being optimized away
+        g_devConsole->AddLine(DevConsole::INFO_MINOR,
+                              Stringf("  %-6s kernel  disc %6.2f ns/test  point %6.2f ns/test  speedup %.2fx / %.2fx  %d hits",
+                                      GetCollisionKernelPathName(path),
+                                      discSeconds * 1.0e9 / numTests,
+                                      pointSeconds * 1.0e9 / numTests,
+                                      discSeconds > 0.0 ? engineDiscSeconds / discSeconds : 0.0,
+                                      pointSeconds > 0.0 ? enginePointSeconds / pointSeconds : 0.0,
+                                      numHits));
+    }
+
+    SetCollisionKernelPath(originalPath);
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC bool GameBenchmark::Command_RunBroadphaseBenchmark(EventArgs& args)
+{
+    int const numEnemies = args.GetValue("enemies", BENCHMARK_DEFAULT_ENEMY_NUM);
+    int const numBullets = args.GetValue("bullets", BENCHMARK_DEFAULT_BULLET_NUM);
+    int const numFrames  = args.GetValue("frames", BENCHMARK_DEFAULT_FRAME_NUM);
+
+    if (numEnemies <= 0 || numBullets <= 0 || numFrames <= 0 ||
+        numEnemies > static_cast<int>(EntityHandle::INDEX_MASK))
+    {
+        g_devConsole->AddLine(DevConsole::ERROR, "Usage: benchmarkbroadphase enemies=PositiveInt bullets=PositiveInt frames=PositiveInt");
+        return false;
+    }
+
+    RunBroadphaseBenchmark(numEnemies, numBullets, numFrames);
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Both broadphases see the same scenes frame for frame. Both feed the same kernel, so their overlap
+// counts must agree; a difference is reported as an error.
+//
+STATIC void GameBenchmark::RunBroadphaseBenchmark(int const numEnemies, int const numBullets, int const numFrames)
+{
+    g_devConsole->AddLine(DevConsole::INFO_MAJOR,
+                          Stringf("Broadphase benchmark: %d enemies, %d bullet queries x %d frames", numEnemies, numBullets, numFrames));
+
+    for (int sceneIndex = 0; sceneIndex < static_cast<int>(eBroadphaseScene::NUM); ++sceneIndex)
+    {
+        sBroadphaseScene const scene = MakeBroadphaseScene(static_cast<eBroadphaseScene>(sceneIndex), numEnemies, numBullets);
+
+        CollisionGrid     grid(Vec2(WORLD_SIZE_X, WORLD_SIZE_Y), COLLISION_GRID_CELL_SIZE, numEnemies);
+        SweepAndPrune     sweepAndPrune(numEnemies);
+        sBroadphaseTiming timings[static_cast<int>(eBroadphase::NUM)];
+
+        timings[static_cast<int>(eBroadphase::GRID)]            = TimeBroadphase(grid, scene, numFrames);
+        timings[static_cast<int>(eBroadphase::SWEEP_AND_PRUNE)] = TimeBroadphase(sweepAndPrune, scene, numFrames);
+
+        for (int broadphaseIndex = 0; broadphaseIndex < static_cast<int>(eBroadphase::NUM); ++broadphaseIndex)
+        {
+            sBroadphaseTiming const& timing = timings[broadphaseIndex];
+
+            g_devConsole->AddLine(DevConsole::INFO_MINOR,
+                                  Stringf("  %-8s %-5s build %7.3f ms  query %7.3f ms  %6.1f candidates/query  %d overlaps/frame  %d sort shifts/frame",
+                                          BROADPHASE_SCENE_NAMES[sceneIndex],
+                                          BROADPHASE_NAMES[broadphaseIndex],
+                                          timing.m_buildSeconds * 1000.0 / numFrames,
+                                          timing.m_querySeconds * 1000.0 / numFrames,
+                                          static_cast<double>(timing.m_numCandidates) / (static_cast<double>(numBullets) * numFrames),
+                                          timing.m_numOverlaps / numFrames,
+                                          timing.m_numSortShifts / numFrames));
+        }
+
+        if (timings[0].m_numOverlaps != timings[1].m_numOverlaps)
+        {
+            g_devConsole->AddLine(DevConsole::ERROR,
+                                  Stringf("  %-8s overlap counts differ: grid %d, sap %d",
+                                          BROADPHASE_SCENE_NAMES[sceneIndex], timings[0].m_numOverlaps, timings[1].m_numOverlaps));
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC bool GameBenchmark::Command_RunParallelCollisionBenchmark(EventArgs& args)
+{
+    int const numEnemies = args.GetValue("enemies", BENCHMARK_STRESS_ENTITY_NUM);
+    int const numBullets = args.GetValue("bullets", BENCHMARK_STRESS_ENTITY_NUM);
+    int const numFrames  = args.GetValue("frames", BENCHMARK_STRESS_FRAME_NUM);
+
+    if (numEnemies <= 0 || numBullets <= 0 || numFrames <= 0 ||
+        numEnemies > static_cast<int>(EntityHandle::INDEX_MASK) ||
+        numBullets > static_cast<int>(EntityHandle::INDEX_MASK))
+    {
+        g_devConsole->AddLine(DevConsole::ERROR, "Usage: benchmarkparallel enemies=PositiveInt bullets=PositiveInt frames=PositiveInt");
+        return false;
+    }
+
+    RunParallelCollisionBenchmark(numEnemies, numBullets, numFrames);
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Bullet detection split into COLLISION_BULLETS_PER_TASK ranges as Game splits it, on 1, 2, 4 and 8
+// threads over the same swarm scene. Only detection is timed; the grid rebuild stays serial. Every
+// run must produce exactly the single-threaded hits, in the same order.
+//
+STATIC void GameBenchmark::RunParallelCollisionBenchmark(int const numEnemies, int const numBullets, int const numFrames)
+{
+    int const              threadCounts[] = {1, 2, 4, 8};
+    int const              numTasks       = (numBullets + COLLISION_BULLETS_PER_TASK - 1) / COLLISION_BULLETS_PER_TASK;
+    sBroadphaseScene const initialScene   = MakeBroadphaseScene(eBroadphaseScene::SWARM, numEnemies, numBullets);
+
+    CollisionGrid                       grid(Vec2(WORLD_SIZE_X, WORLD_SIZE_Y), COLLISION_GRID_CELL_SIZE, numEnemies);
+    std::vector<CollisionCommandBuffer> buffers(numTasks);
+
+    for (CollisionCommandBuffer& commands : buffers)
+    {
+        commands.Reserve(COLLISION_BULLETS_PER_TASK);
+    }
+
+    g_devConsole->AddLine(DevConsole::INFO_MAJOR,
+                          Stringf("Parallel collision benchmark: %d enemies, %d bullets in %d tasks x %d frames (%d hardware threads)",
+                                  numEnemies, numBullets, numTasks, numFrames,
+                                  static_cast<int>(std::thread::hardware_concurrency())));
+
+    double   singleThreadSeconds = 0.0;
+    uint64_t singleThreadHash    = 0;
+
+    for (int const numThreads : threadCounts)
+    {
+        WorkerPool       pool(numThreads);
+        sBroadphaseScene scene         = initialScene;
+        double           detectSeconds = 0.0;
+        uint64_t         hash          = 14695981039346656037ull;
+        int              numHits       = 0;
+
+        for (int frameIndex = 0; frameIndex < numFrames; ++frameIndex)
+        {
+            StepAndWrapPositions(scene.m_enemyPositions, scene.m_enemyVelocities);
+            StepAndWrapPositions(scene.m_bulletPositions, scene.m_bulletVelocities);
+
+            grid.Clear();
+
+            for (int enemyIndex = 0; enemyIndex < numEnemies; ++enemyIndex)
+            {
+                grid.Insert({scene.m_enemyPositions[enemyIndex], scene.m_enemyRadii[enemyIndex], EntityHandle(enemyIndex, 0), eEntityKind::ASTEROID});
+            }
+
+            grid.Build();
+
+            for (CollisionCommandBuffer& commands : buffers)
+            {
+                commands.Clear();
+            }
+
+            double const startSeconds = GetCurrentTimeSeconds();
+
+            pool.ParallelFor(numTasks, [&grid, &scene, &buffers, numBullets](int const taskIndex)
+            {
+                int const firstBullet = taskIndex * COLLISION_BULLETS_PER_TASK;
+                int const endBullet   = std::min(firstBullet + COLLISION_BULLETS_PER_TASK, numBullets);
+
+                DetectSceneBulletHits(grid, scene, firstBullet, endBullet, buffers[taskIndex]);
+            });
+
+            detectSeconds += GetCurrentTimeSeconds() - startSeconds;
+            hash          =  HashCollisionHits(hash, buffers);
+
+            for (CollisionCommandBuffer const& commands : buffers)
+            {
+                numHits += static_cast<int>(commands.GetHits().size());
+            }
+        }
+
+        if (numThreads == 1)
+        {
+            singleThreadSeconds = detectSeconds;
+            singleThreadHash    = hash;
+        }
+
+        double const speedup = detectSeconds > 0.0 ? singleThreadSeconds / detectSeconds : 0.0;
+
+        g_devConsole->AddLine(hash == singleThreadHash ? DevConsole::INFO_MINOR : DevConsole::ERROR,
+                              Stringf("  %d thread%s %8.3f ms/frame  speedup %5.2fx  efficiency %5.1f%%  %d hits/frame  %s",
+                                      numThreads, numThreads == 1 ? " " : "s",
+                                      detectSeconds * 1000.0 / numFrames,
+                                      speedup,
+                                      speedup * 100.0 / numThreads,
+                                      numHits / numFrames,
+                                      hash == singleThreadHash ? "identical" : "DIFFERS from 1 thread"));
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC bool GameBenchmark::Command_RunSweepQueryBenchmark(EventArgs& args)
+{
+    int const   numEnemies = args.GetValue("enemies", BENCHMARK_DEFAULT_ENEMY_NUM);
+    int const   numQueries = args.GetValue("queries", BENCHMARK_SWEEP_QUERY_NUM);
+    float const maxLength  = args.GetValue("length", BENCHMARK_SWEEP_LENGTH);
+    float const radius     = args.GetValue("radius", BENCHMARK_SWEEP_RADIUS);
+
+    if (numEnemies <= 0 || numQueries <= 0 || maxLength <= 0.f || radius < 0.f ||
+        numEnemies > static_cast<int>(EntityHandle::INDEX_MASK))
+    {
+        g_devConsole->AddLine(DevConsole::ERROR, "Usage: benchmarksweep enemies=PositiveInt queries=PositiveInt length=PositiveFloat radius=NonNegativeFloat");
+        return false;
+    }
+
+    RunSweepQueryBenchmark(numEnemies, numQueries, maxLength, radius);
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Beam-like sweeps from random points in random directions, answered four ways: every enemy, the
+// grid over the disc around the whole segment (what bullets use for their short steps), the grid
+// walked along the segment, and sweep-and-prune over the segment's x range. All four must find the
+// same first enemy for every query; any that does not is reported as an error.
+//
+STATIC void GameBenchmark::RunSweepQueryBenchmark(int const numEnemies, int const numQueries, float const maxLength, float const radius)
+{
+    char const* const methodNames[] = {"all", "grid-disc", "grid-walk", "sap"};
+    constexpr int     numMethods    = 4;
+
+    g_devConsole->AddLine(DevConsole::INFO_MAJOR,
+                          Stringf("Sweep query benchmark: %d enemies, %d queries of length %.1f, radius %.2f", numEnemies, numQueries, maxLength, radius));
+
+    std::vector<sSweepQuery> queries(numQueries);
+
+    for (sSweepQuery& query : queries)
+    {
+        query.m_start     = RollRandomWorldPosition();
+        query.m_direction = Vec2::MakeFromPolarDegrees(g_rng->RollRandomFloatInRange(0.f, 360.f));
+        query.m_maxLength = maxLength;
+        query.m_radius    = radius;
+    }
+
+    for (int sceneIndex = 0; sceneIndex < static_cast<int>(eBroadphaseScene::NUM); ++sceneIndex)
+    {
+        sBroadphaseScene const scene = MakeBroadphaseScene(static_cast<eBroadphaseScene>(sceneIndex), numEnemies, 0);
+
+        std::vector<sBroadphaseEntry> entries;
+        CollisionGrid                 grid(Vec2(WORLD_SIZE_X, WORLD_SIZE_Y), COLLISION_GRID_CELL_SIZE, numEnemies);
+        SweepAndPrune                 sweepAndPrune(numEnemies);
+
+        for (int enemyIndex = 0; enemyIndex < numEnemies; ++enemyIndex)
+        {
+            entries.push_back({scene.m_enemyPositions[enemyIndex], scene.m_enemyRadii[enemyIndex], EntityHandle(enemyIndex, 0), eEntityKind::ASTEROID});
+            grid.Insert(entries.back());
+            sweepAndPrune.Insert(entries.back());
+        }
+
+        grid.Build();
+        sweepAndPrune.Build();
+
+        std::vector<sSweepBenchmarkHit> hits[numMethods];
+        double                          seconds[numMethods]       = {};
+        int                             numCandidates[numMethods] = {numEnemies * numQueries};
+
+        for (std::vector<sSweepBenchmarkHit>& methodHits : hits)
+        {
+            methodHits.resize(numQueries);
+        }
+
+        seconds[0] = TimeSweepQueries(queries, hits[0], [&entries](sSweepQuery const&, auto&& func)
+        {
+            for (sBroadphaseEntry const& enemy : entries)
+            {
+                func(enemy);
+            }
+        });
+
+        seconds[1] = TimeSweepQueries(queries, hits[1], [&grid](sSweepQuery const& query, auto&& func)
+        {
+            grid.ForEachCandidate(query.m_start + query.m_direction * (query.m_maxLength * 0.5f), query.m_maxLength * 0.5f + query.m_radius, func);
+        });
+
+        numCandidates[1] = grid.GetNumCandidatesVisited();
+
+        seconds[2] = TimeSweepQueries(queries, hits[2], [&grid](sSweepQuery const& query, auto&& func)
+        {
+            grid.ForEachCandidateAlongSegment(query.m_start, query.m_direction * query.m_maxLength, query.m_radius, func);
+        });
+
+        numCandidates[2] = grid.GetNumCandidatesVisited() - numCandidates[1];
+
+        seconds[3] = TimeSweepQueries(queries, hits[3], [&sweepAndPrune](sSweepQuery const& query, auto&& func)
+        {
+            sweepAndPrune.ForEachCandidateAlongSegment(query.m_start, query.m_direction * query.m_maxLength, query.m_radius, func);
+        });
+
+        numCandidates[3] = sweepAndPrune.GetNumCandidatesVisited();
+
+        for (int methodIndex = 0; methodIndex < numMethods; ++methodIndex)
+        {
+            int numHits       = 0;
+            int numMismatches = 0;
+
+            for (int queryIndex = 0; queryIndex < numQueries; ++queryIndex)
+            {
+                if (hits[methodIndex][queryIndex].m_enemyIndex >= 0) ++numHits;
+                if (hits[methodIndex][queryIndex].m_enemyIndex != hits[0][queryIndex].m_enemyIndex) ++numMismatches;
+            }
+
+            g_devConsole->AddLine(numMismatches == 0 ? DevConsole::INFO_MINOR : DevConsole::ERROR,
+                                  Stringf("  %-8s %-9s %8.3f ms  %8.1f candidates/query  %d hits  %d mismatches",
+                                          BROADPHASE_SCENE_NAMES[sceneIndex],
+                                          methodNames[methodIndex],
+                                          seconds[methodIndex] * 1000.0,
+                                          static_cast<double>(numCandidates[methodIndex]) / numQueries,
+                                          numHits,
+                                          numMismatches));
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC bool GameBenchmark::Command_RunNearestNeighborBenchmark(EventArgs& args)
+{
+    int const numEnemies   = args.GetValue("enemies", BENCHMARK_DEFAULT_ENEMY_NUM);
+    int const numQueries   = args.GetValue("queries", BENCHMARK_DEFAULT_QUERY_NUM);
+    int const numNeighbors = args.GetValue("k", BENCHMARK_NEIGHBOR_NUM);
+
+    if (numEnemies <= 0 || numQueries <= 0 || numNeighbors <= 0 || numNeighbors > BENCHMARK_MAX_NEIGHBOR_NUM ||
+        numEnemies > static_cast<int>(EntityHandle::INDEX_MASK))
+    {
+        g_devConsole->AddLine(DevConsole::ERROR, Stringf("Usage: benchmarkneighbors enemies=PositiveInt queries=PositiveInt k=[1, %d]", BENCHMARK_MAX_NEIGHBOR_NUM));
+        return false;
+    }
+
+    RunNearestNeighborBenchmark(numEnemies, numQueries, numNeighbors);
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+// k nearest enemies to random points, found by sorting every distance, by the grid's ring search and
+// by sweep-and-prune's outward walk. Ties may legitimately pick different enemies, so the three are
+// compared rank by rank on distance; any difference is reported as an error.
+//
+STATIC void GameBenchmark::RunNearestNeighborBenchmark(int const numEnemies, int const numQueries, int const numNeighbors)
+{
+    char const* const methodNames[] = {"sort-all", "grid", "sap"};
+    constexpr int     numMethods    = 3;
+
+    g_devConsole->AddLine(DevConsole::INFO_MAJOR,
+                          Stringf("Nearest-neighbor benchmark: %d enemies, %d queries, k = %d", numEnemies, numQueries, numNeighbors));
+
+    std::vector<Vec2> centers(numQueries);
+
+    for (Vec2& center : centers)
+    {
+        center = RollRandomWorldPosition();
+    }
+
+    auto const acceptAll = [](sBroadphaseEntry const&) { return true; };
+
+    for (int sceneIndex = 0; sceneIndex < static_cast<int>(eBroadphaseScene::NUM); ++sceneIndex)
+    {
+        sBroadphaseScene const scene = MakeBroadphaseScene(static_cast<eBroadphaseScene>(sceneIndex), numEnemies, 0);
+
+        std::vector<sBroadphaseEntry> entries;
+        CollisionGrid                 grid(Vec2(WORLD_SIZE_X, WORLD_SIZE_Y), COLLISION_GRID_CELL_SIZE, numEnemies);
+        SweepAndPrune                 sweepAndPrune(numEnemies);
+
+        for (int enemyIndex = 0; enemyIndex < numEnemies; ++enemyIndex)
+        {
+            entries.push_back({scene.m_enemyPositions[enemyIndex], scene.m_enemyRadii[enemyIndex], EntityHandle(enemyIndex, 0), eEntityKind::ASTEROID});
+            grid.Insert(entries.back());
+            sweepAndPrune.Insert(entries.back());
+        }
+
+        grid.Build();
+        sweepAndPrune.Build();
+
+        std::vector<sBroadphaseNeighbor> neighbors[numMethods];
+        std::vector<int>                 counts[numMethods];
+        double                           seconds[numMethods]       = {};
+        int                              numCandidates[numMethods] = {numEnemies * numQueries};
+        std::vector<sBroadphaseNeighbor> allNeighbors(numEnemies);
+
+        for (int methodIndex = 0; methodIndex < numMethods; ++methodIndex)
+        {
+            neighbors[methodIndex].resize(static_cast<size_t>(numQueries) * numNeighbors);
+            counts[methodIndex].resize(numQueries);
+        }
+
+        seconds[0] = TimeNearestNeighborQueries(centers, numNeighbors, neighbors[0], counts[0], [&](Vec2 const& center, sBroadphaseNeighbor* out_neighbors)
+        {
+            for (int enemyIndex = 0; enemyIndex < numEnemies; ++enemyIndex)
+            {
+                sBroadphaseEntry const& enemy   = entries[enemyIndex];
+                float const             offsetX = enemy.m_center.x - center.x;
+                float const             offsetY = enemy.m_center.y - center.y;
+
+                allNeighbors[enemyIndex] = {enemy.m_center, std::sqrt(offsetX * offsetX + offsetY * offsetY), enemy.m_handle, enemy.m_kind};
+            }
+
+            int const numKept = std::min(numNeighbors, numEnemies);
+
+            std::partial_sort(allNeighbors.begin(), allNeighbors.begin() + numKept, allNeighbors.end(), [](sBroadphaseNeighbor const& a, sBroadphaseNeighbor const& b)
+            {
+                return a.m_distance < b.m_distance;
+            });
+
+            std::copy(allNeighbors.begin(), allNeighbors.begin() + numKept, out_neighbors);
+
+            return numKept;
+        });
+
+        seconds[1] = TimeNearestNeighborQueries(centers, numNeighbors, neighbors[1], counts[1], [&](Vec2 const& center, sBroadphaseNeighbor* out_neighbors)
+        {
+            return grid.FindNearest(center, FLT_MAX, numNeighbors, out_neighbors, acceptAll);
+        });
+
+        numCandidates[1] = grid.GetNumCandidatesVisited();
+
+        seconds[2] = TimeNearestNeighborQueries(centers, numNeighbors, neighbors[2], counts[2], [&](Vec2 const& center, sBroadphaseNeighbor* out_neighbors)
+        {
+            return sweepAndPrune.FindNearest(center, FLT_MAX, numNeighbors, out_neighbors, acceptAll);
+        });
+
+        numCandidates[2] = sweepAndPrune.GetNumCandidatesVisited();
+
+        for (int methodIndex = 0; methodIndex < numMethods; ++methodIndex)
+        {
+            int numMismatches = 0;
+
+            for (int queryIndex = 0; queryIndex < numQueries; ++queryIndex)
+            {
+                bool isSame = counts[methodIndex][queryIndex] == counts[0][queryIndex];
+
+                for (int rank = 0; isSame && rank < counts[0][queryIndex]; ++rank)
+                {
+                    size_t const slot = static_cast<size_t>(queryIndex) * numNeighbors + rank;
+
+                    isSame = neighbors[methodIndex][slot].m_distance == neighbors[0][slot].m_distance;
+                }
+
+                if (!isSame) ++numMismatches;
+            }
+
+            g_devConsole->AddLine(numMismatches == 0 ? DevConsole::INFO_MINOR : DevConsole::ERROR,
+                                  Stringf("  %-8s %-8s %8.3f ms  %8.1f candidates/query  %d mismatches",
+                                          BROADPHASE_SCENE_NAMES[sceneIndex],
+                                          methodNames[methodIndex],
+                                          seconds[methodIndex] * 1000.0,
+                                          static_cast<double>(numCandidates[methodIndex]) / numQueries,
+                                          numMismatches));
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC bool GameBenchmark::Command_RunShapeInstancingBenchmark(EventArgs& args)
+{
+    int const numInstances = args.GetValue("instances", BENCHMARK_DEFAULT_ENTITY_NUM);
+    int const numFrames    = args.GetValue("frames", BENCHMARK_INSTANCE_FRAME_NUM);
+
+    if (numInstances <= 0 || numFrames <= 0)
+    {
+        g_devConsole->AddLine(DevConsole::ERROR, "Usage: benchmarkinstancing instances=PositiveInt frames=PositiveInt");
+        return false;
+    }
+
+    return RunShapeInstancingBenchmark(numInstances, numFrames);
+}
+
+//----------------------------------------------------------------------------------------------------
+// Every instanced mesh, drawn numInstances times at random transforms, first the way the renderers
+// used to (copy the local verts, tint them, TransformVertexArrayXY3D) and then as sShapeInstance
+// records expanded by ExpandShapeInstances. The two must give the same verts; the bytes column is
+// what a frame would upload with each, the expanded verts against the records alone.
+//
+STATIC bool GameBenchmark::RunShapeInstancingBenchmark(int const numInstances, int const numFrames)
+{
+    struct sBenchmarkMesh
+    {
+        char const*       m_name;
+        Vertex_PCU const* m_localVerts;
+        int               m_numVerts;
+        bool              m_isPreColored;
+    };
+
+    MeshLibrary const meshLibrary(ASTEROID_MESH_VARIANT_NUM, DEBRIS_MESH_VARIANT_NUM);
+
+    sBenchmarkMesh const meshes[] = {
+        {"ship", meshLibrary.GetPlayerShipVerts(), PLAYER_SHIP_VERTS_NUM, MeshLibrary::IsPreColored(eMeshId::PLAYER_SHIP)},
+        {"bullet", meshLibrary.GetBulletVerts(), BULLET_VERTS_NUM, MeshLibrary::IsPreColored(eMeshId::BULLET)},
+        {"asteroid", meshLibrary.GetAsteroidVerts(0), ASTEROID_VERTS_NUM, MeshLibrary::IsPreColored(eMeshId::ASTEROID)},
+        {"beetle", meshLibrary.GetBeetleVerts(), BEETLE_VERTS_NUM, MeshLibrary::IsPreColored(eMeshId::BEETLE)},
+        {"wasp", meshLibrary.GetWaspVerts(), WASP_VERTS_NUM, MeshLibrary::IsPreColored(eMeshId::WASP)},
+        {"box", meshLibrary.GetBoxVerts(), BOX_VERTS_NUM, false},
+    };
+
+    g_devConsole->AddLine(DevConsole::INFO_MAJOR,
+                          Stringf("Shape instancing benchmark: %d instances per mesh, %d frames", numInstances, numFrames));
+
+    std::vector<sShapeInstance> sources(numInstances);
+    std::vector<sShapeInstance> instances(numInstances);
+
+    for (sShapeInstance& source : sources)
+    {
+        source.m_position           = RollRandomWorldPosition();
+        source.m_orientationDegrees = g_rng->RollRandomFloatInRange(0.f, 360.f);
+        source.m_scale              = g_rng->RollRandomFloatInRange(0.5f, 4.f);
+        source.m_color              = Rgba8(static_cast<unsigned char>(g_rng->RollRandomIntInRange(0, 255)), 128, 64, 255);
+    }
+
+    bool isPassing = true;
+
+    for (sBenchmarkMesh const& mesh : meshes)
+    {
+        size_t const            numVerts = static_cast<size_t>(numInstances) * mesh.m_numVerts;
+        std::vector<Vertex_PCU> legacyVerts(numVerts);
+        std::vector<Vertex_PCU> instancedVerts(numVerts);
+
+        double startSeconds = GetCurrentTimeSeconds();
+
+        for (int frameIndex = 0; frameIndex < numFrames; ++frameIndex)
+        {
+            for (int instanceIndex = 0; instanceIndex < numInstances; ++instanceIndex)
+            {
+                sShapeInstance const& source     = sources[instanceIndex];
+                Vertex_PCU*           worldVerts = legacyVerts.data() + static_cast<size_t>(instanceIndex) * mesh.m_numVerts;
+
+                std::copy(mesh.m_localVerts, mesh.m_localVerts + mesh.m_numVerts, worldVerts);
+
+                if (!mesh.m_isPreColored)
+                {
+                    for (int vertIndex = 0; vertIndex < mesh.m_numVerts; ++vertIndex)
+                    {
+                        worldVerts[vertIndex].m_color = source.m_color;
+                    }
+                }
+
+                TransformVertexArrayXY3D(mesh.m_numVerts, worldVerts, source.m_scale, source.m_orientationDegrees, source.m_position);
+            }
+        }
+
+        double const legacySeconds = GetCurrentTimeSeconds() - startSeconds;
+
+        startSeconds = GetCurrentTimeSeconds();
+
+        for (int frameIndex = 0; frameIndex < numFrames; ++frameIndex)
+        {
+            std::copy(sources.begin(), sources.end(), instances.begin());
+            ExpandShapeInstances(mesh.m_localVerts, mesh.m_numVerts, mesh.m_isPreColored, instances.data(), numInstances, instancedVerts.data());
+        }
+
+        double const instancedSeconds = GetCurrentTimeSeconds() - startSeconds;
+
+        float maxError       = 0.f;
+        int   numColorMisses = 0;
+
+        for (size_t vertIndex = 0; vertIndex < numVerts; ++vertIndex)
+        {
+            Vec3 const& legacy    = legacyVerts[vertIndex].m_position;
+            Vec3 const& instanced = instancedVerts[vertIndex].m_position;
+
+            maxError = std::max(maxError, std::max(std::fabs(legacy.x - instanced.x), std::fabs(legacy.y - instanced.y)));
+
+            if (std::memcmp(&legacyVerts[vertIndex].m_color, &instancedVerts[vertIndex].m_color, sizeof(Rgba8)) != 0) ++numColorMisses;
+        }
+
+        bool const isMatching = maxError <= BENCHMARK_INSTANCE_MAX_ERROR && numColorMisses == 0;
+
+        isPassing = isPassing && isMatching;
+
+        g_devConsole->AddLine(isMatching ? DevConsole::INFO_MINOR : DevConsole::ERROR,
+                              Stringf("  %-8s transform %8.3f ms  instanced %8.3f ms  bytes/frame %9d vs %7d  max error %.6f  %d color misses",
+                                      mesh.m_name,
+                                      legacySeconds * 1000.0 / numFrames,
+                                      instancedSeconds * 1000.0 / numFrames,
+                                      static_cast<int>(numVerts * sizeof(Vertex_PCU)),
+                                      static_cast<int>(numInstances * sizeof(sShapeInstance)),
+                                      static_cast<double>(maxError),
+                                      numColorMisses));
+    }
+
+    return isPassing;
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC bool GameBenchmark::Command_RunParallelVertexBenchmark(EventArgs& args)
+{
+    int const numInstances = args.GetValue("instances", BENCHMARK_DEFAULT_ENTITY_NUM);
+    int const numDebris    = args.GetValue("debris", BENCHMARK_DEFAULT_ENTITY_NUM);
+    int const numFrames    = args.GetValue("frames", BENCHMARK_INSTANCE_FRAME_NUM);
+
+    if (numInstances < 0 || numDebris < 0 || numInstances + numDebris == 0 || numFrames <= 0)
+    {
+        g_devConsole->AddLine(DevConsole::ERROR, "Usage: benchmarkvertexgen instances=NonNegativeInt debris=NonNegativeInt frames=PositiveInt");
+        return false;
+    }
+
+    return RunParallelVertexBenchmark(numInstances, numDebris, numFrames);
+}
+
+//----------------------------------------------------------------------------------------------------
+// Every entity mesh instanced in equal shares, submitted kind by kind as Game does, plus a field of
+// debris, all inside the cull bounds. The world verts are generated the way RenderBatcher::Flush and
+// DebrisSystem::Render generate them, on 1, 2, 4 and 8 threads; only generation is timed, not
+// submission. Every run must write exactly the single-threaded stream.
+//
+STATIC bool GameBenchmark::RunParallelVertexBenchmark(int const numInstances, int const numDebris, int const numFrames)
+{
+    int const         threadCounts[] = {1, 2, 4, 8};
+    MeshLibrary const meshLibrary(ASTEROID_MESH_VARIANT_NUM, DEBRIS_MESH_VARIANT_NUM);
+    RenderBatcher     batcher;
+    DebrisSystem      debris(std::max(numDebris, 1), &meshLibrary);
+    int               meshIndices[MESH_ID_NUM];
+    int               maxMeshVerts = 0;
+
+    for (int meshIdIndex = 0; meshIdIndex < MESH_ID_NUM; ++meshIdIndex)
+    {
+        eMeshId const meshId = static_cast<eMeshId>(meshIdIndex);
+
+        meshIndices[meshIdIndex] = batcher.RegisterMesh(meshLibrary.GetVerts(meshId, 0), MeshLibrary::GetNumVerts(meshId), MeshLibrary::IsPreColored(meshId));
+        maxMeshVerts             = std::max(maxMeshVerts, MeshLibrary::GetNumVerts(meshId));
+    }
+
+    batcher.Reserve(numInstances * maxMeshVerts + numDebris * DEBRIS_VERTS_NUM);
+
+    std::vector<sShapeInstance> instances(numInstances);
+
+    for (sShapeInstance& instance : instances)
+    {
+        instance.m_position           = RollRandomWorldPosition();
+        instance.m_orientationDegrees = g_rng->RollRandomFloatInRange(0.f, 360.f);
+        instance.m_scale              = g_rng->RollRandomFloatInRange(0.5f, 4.f);
+        instance.m_color              = Rgba8(static_cast<unsigned char>(g_rng->RollRandomIntInRange(0, 255)), 128, 64, 255);
+    }
+
+    for (int debrisIndex = 0; debrisIndex < numDebris; ++debrisIndex)
+    {
+        debris.SpawnDebris(RollRandomWorldPosition(), Vec2::ZERO, g_rng->RollRandomFloatInRange(0.25f, 1.f), Rgba8(200, 180, 160, 255));
+    }
+
+    int const numInstanceTasks = (numInstances + RENDER_SHAPES_PER_TASK - 1) / RENDER_SHAPES_PER_TASK;
+    int const numDebrisTasks   = (numDebris + RENDER_SHAPES_PER_TASK - 1) / RENDER_SHAPES_PER_TASK;
+
+    g_devConsole->AddLine(DevConsole::INFO_MAJOR,
+                          Stringf("Parallel vertex benchmark: %d instances, %d debris in %d + %d tasks x %d frames (%d hardware threads)",
+                                  numInstances, numDebris, numInstanceTasks, numDebrisTasks, numFrames,
+                                  static_cast<int>(std::thread::hardware_concurrency())));
+
+    double   singleThreadInstanceSeconds = 0.0;
+    double   singleThreadDebrisSeconds   = 0.0;
+    uint64_t singleThreadHash            = 0;
+    bool     isPassing                   = true;
+
+    for (int const numThreads : threadCounts)
+    {
+        WorkerPool pool(numThreads);
+        double     instanceSeconds = 0.0;
+        double     debrisSeconds   = 0.0;
+
+        for (int frameIndex = 0; frameIndex < numFrames; ++frameIndex)
+        {
+            batcher.Begin();
+
+            for (int instanceIndex = 0; instanceIndex < numInstances; ++instanceIndex)
+            {
+                int const meshIdIndex = static_cast<int>(static_cast<int64_t>(instanceIndex) * MESH_ID_NUM / numInstances);
+
+                batcher.AppendInstance(sRenderState(), meshIndices[meshIdIndex], instances[instanceIndex]);
+            }
+
+            double const startSeconds = GetCurrentTimeSeconds();
+
+            batcher.ExpandInstances(pool);
+
+            double const instanceEndSeconds = GetCurrentTimeSeconds();
+
+            debris.Render(batcher, pool);
+
+            instanceSeconds += instanceEndSeconds - startSeconds;
+            debrisSeconds   += GetCurrentTimeSeconds() - instanceEndSeconds;
+        }
+
+        // Every vert is written, and Vertex_PCU has no padding, so its bytes are the whole result
+        uint64_t          hash  = 14695981039346656037ull;
+        auto const* const bytes = reinterpret_cast<unsigned char const*>(batcher.GetVerts());
+
+        for (size_t byteIndex = 0; byteIndex < static_cast<size_t>(batcher.GetNumVerts()) * sizeof(Vertex_PCU); ++byteIndex)
+        {
+            hash = (hash ^ bytes[byteIndex]) * 1099511628211ull;
+        }
+
+        if (numThreads == 1)
+        {
+            singleThreadInstanceSeconds = instanceSeconds;
+            singleThreadDebrisSeconds   = debrisSeconds;
+            singleThreadHash            = hash;
+        }
+
+        bool const   isMatching      = hash == singleThreadHash;
+        double const instanceSpeedup = instanceSeconds > 0.0 ? singleThreadInstanceSeconds / instanceSeconds : 0.0;
+        double const debrisSpeedup   = debrisSeconds > 0.0 ? singleThreadDebrisSeconds / debrisSeconds : 0.0;
+
+        isPassing = isPassing && isMatching;
+
+        g_devConsole->AddLine(isMatching ? DevConsole::INFO_MINOR : DevConsole::ERROR,
+                              Stringf("  %d thread%s instances %8.3f ms/frame (%5.2fx)  debris %8.3f ms/frame (%5.2fx)  %d verts  %s",
+                                      numThreads, numThreads == 1 ? " " : "s",
+                                      instanceSeconds * 1000.0 / numFrames,
+                                      instanceSpeedup,
+                                      debrisSeconds * 1000.0 / numFrames,
+                                      debrisSpeedup,
+                                      batcher.GetNumVerts(),
+                                      isMatching ? "identical" : "DIFFERS from 1 thread"));
+    }
+
+    return isPassing;
+}
@@ -0,0 +1,54 @@
+//----------------------------------------------------------------------------------------------------
+// GameBenchmark.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Core/EventSystem.hpp"
+
+//----------------------------------------------------------------------------------------------------
+// Dev console micro-benchmarks for the gameplay hot paths.
+// They run synchronously on standalone entity sets, so they never disturb the live Game state.
+//
+class GameBenchmark
+{
+public:
+    // benchmark entities=20000 frames=100
+    static bool Command_RunEntityUpdateBenchmark(EventArgs& args);
+
+    // benchmarkcollision bullets=100 enemies=2000 frames=100
+    static bool Command_RunCollisionDispatchBenchmark(EventArgs& args);
+
+    // benchmarkkernels shapes=1024 queries=2000
+    static bool Command_RunCollisionKernelBenchmark(EventArgs& args);
+
+    // benchmarkbroadphase enemies=2000 bullets=100 frames=100
+    static bool Command_RunBroadphaseBenchmark(EventArgs& args);
+
+    // benchmarkparallel enemies=20000 bullets=20000 frames=30
+    static bool Command_RunParallelCollisionBenchmark(EventArgs& args);
+
+    // benchmarksweep enemies=2000 queries=500 length=60 radius=0.5
+    static bool Command_RunSweepQueryBenchmark(EventArgs& args);
+
+    // benchmarkneighbors enemies=2000 queries=2000 k=4
+    static bool Command_RunNearestNeighborBenchmark(EventArgs& args);
+
+    // benchmarkinstancing instances=20000 frames=30
+    static bool Command_RunShapeInstancingBenchmark(EventArgs& args);
+
+    // benchmarkvertexgen instances=20000 debris=20000 frames=30
+    static bool Command_RunParallelVertexBenchmark(EventArgs& args);
+
+    static void RunEntityUpdateBenchmark(int numEntities, int numFrames);
+    static void RunCollisionDispatchBenchmark(int numBullets, int numEnemies, int numFrames);
+    static bool RunCollisionKernelSelfCheck(int numShapes, int numQueries); // returns whether every path matched
+    static void RunCollisionKernelBenchmark(int numShapes, int numQueries);
+    static void RunBroadphaseBenchmark(int numEnemies, int numBullets, int numFrames);
+    static void RunParallelCollisionBenchmark(int numEnemies, int numBullets, int numFrames);
+    static void RunSweepQueryBenchmark(int numEnemies, int numQueries, float maxLength, float radius);
+    static void RunNearestNeighborBenchmark(int numEnemies, int numQueries, int numNeighbors);
+    static bool RunShapeInstancingBenchmark(int numInstances, int numFrames); // returns whether both paths matched
+    static bool RunParallelVertexBenchmark(int numInstances, int numDebris, int numFrames); // returns whether every thread count matched 1 thread
+};
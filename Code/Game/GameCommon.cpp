@@ -5,10 +5,11 @@
 //----------------------------------------------------------------------------------------------------
 #include "Game/GameCommon.hpp"
 //----------------------------------------------------------------------------------------------------
+#include "Game/RenderBatcher.hpp"
+//----------------------------------------------------------------------------------------------------
 #include "Engine/Core/EngineCommon.hpp"
 #include "Engine/Core/Rgba8.hpp"
 #include "Engine/Math/MathUtils.hpp"
-#include "Engine/Renderer/Renderer.hpp"
 #include "Engine/Renderer/Vertex_PCU.hpp"
 
 //----------------------------------------------------------------------------------------------------
@@ -21,6 +22,7 @@ Rgba8 const BULLET_RED_TRANSPARENT = Rgba8(255, 0, 0, 0);
 Rgba8 const BEETLE_COLOR           = Rgba8(100, 160, 60);
 Rgba8 const WASP_COLOR             = Rgba8(255, 255, 60);
 Rgba8 const ASTEROID_COLOR         = Rgba8(100, 100, 100);
+Rgba8 const BOX_COLOR              = Rgba8(255, 255, 255, 200);
 
 //----------------------------------------------------------------------------------------------------
 // DebugRender color-related
@@ -36,7 +38,7 @@ char const* const IN_GAME_BGM = "Data/Audio/InGame_BGM.mp3";
 
 
 //----------------------------------------------------------------------------------------------------
-void DebugDrawRing(Vec2 const& center, float radius, float thickness, Rgba8 const& color)
+void DebugDrawRing(RenderBatcher& batcher, Vec2 const& center, float radius, float thickness, Rgba8 const& color)
 {
     float         halfThickness = 0.5f * thickness;
     float         innerRadius   = radius - halfThickness;
@@ -44,7 +46,7 @@ void DebugDrawRing(Vec2 const& center, float radius, float thickness, Rgba8 cons
     constexpr int NUM_SIDES     = 32;
     constexpr int NUM_TRIS      = 2 * NUM_SIDES;
     constexpr int NUM_VERTS     = 3 * NUM_TRIS;
-    Vertex_PCU    verts[NUM_VERTS];
+    Vertex_PCU*   verts         = batcher.Append(sRenderState(), NUM_VERTS);
 
     constexpr float DEGREES_PER_SIDE = 360.f / static_cast<float>(NUM_SIDES);
 
@@ -88,13 +90,10 @@ void DebugDrawRing(Vec2 const& center, float radius, float thickness, Rgba8 cons
         verts[vertIndexE].m_color    = color;
         verts[vertIndexF].m_color    = color;
     }
-
-    g_renderer->BindTexture(nullptr);
-    g_renderer->DrawVertexArray(NUM_VERTS, &verts[0]);
 }
 
 //----------------------------------------------------------------------------------------------------
-void DebugDrawLine(Vec2 const& start, Vec2 const& end, float thickness, Rgba8 const& color)
+void DebugDrawLine(RenderBatcher& batcher, Vec2 const& start, Vec2 const& end, float thickness, Rgba8 const& color)
 {
     Vec2 forward = end - start;
     Vec2 normal  = forward.GetNormalized().GetRotated90Degrees();
@@ -106,7 +105,7 @@ void DebugDrawLine(Vec2 const& start, Vec2 const& end, float thickness, Rgba8 co
     Vec3 vertIndexC = Vec3(end.x + halfThicknessOffset.x, end.y + halfThicknessOffset.y, 0.f);
     Vec3 vertIndexD = Vec3(end.x - halfThicknessOffset.x, end.y - halfThicknessOffset.y, 0.f);
 
-    Vertex_PCU verts[6];
+    Vertex_PCU* verts = batcher.Append(sRenderState(), 6);
 
     verts[0].m_position = vertIndexA;
     verts[1].m_position = vertIndexB;
@@ -121,18 +120,15 @@ void DebugDrawLine(Vec2 const& start, Vec2 const& end, float thickness, Rgba8 co
     verts[3].m_color    = color;
     verts[4].m_color    = color;
     verts[5].m_color    = color;
-
-    g_renderer->BindTexture(nullptr);
-    g_renderer->DrawVertexArray(6, &verts[0]);
 }
 
 //----------------------------------------------------------------------------------------------------
-void DebugDrawGlowCircle(Vec2 const& center, float radius, Rgba8 const& color, float glowIntensity)
+void DebugDrawGlowCircle(RenderBatcher& batcher, sRenderState const& state, Vec2 const& center, float radius, Rgba8 const& color, float glowIntensity)
 {
     constexpr int NUM_SIDES = 32;           // Controls the smoothness of the circle
     constexpr int NUM_TRIS  = NUM_SIDES;    // One triangle for each segment
     constexpr int NUM_VERTS = 3 * NUM_TRIS; // Each triangle has 3 vertices
-    Vertex_PCU    verts[NUM_VERTS];
+    Vertex_PCU*   verts     = batcher.Append(state, NUM_VERTS);
 
     constexpr float DEGREES_PER_SIDE = 360.f / static_cast<float>(NUM_SIDES);
 
@@ -172,12 +168,10 @@ void DebugDrawGlowCircle(Vec2 const& center, float radius, Rgba8 const& color, f
         verts[vertIndexC].m_color = glowColor;
     }
 
-    g_renderer->BindTexture(nullptr);
-    g_renderer->DrawVertexArray(NUM_VERTS, &verts[0]);
 }
 
 //----------------------------------------------------------------------------------------------------
-void DebugDrawGlowBox(Vec2 const& center, Vec2 const& dimensions, Rgba8 const& color, float glowIntensity)
+void DebugDrawGlowBox(RenderBatcher& batcher, sRenderState const& state, Vec2 const& center, Vec2 const& dimensions, Rgba8 const& color, float glowIntensity)
 {
     // Calculate the four corners of the rectangle
     float halfWidth  = dimensions.x * 0.5f;
@@ -190,7 +184,7 @@ void DebugDrawGlowBox(Vec2 const& center, Vec2 const& dimensions, Rgba8 const& c
 
     // A rectangle is made of two triangles, each having 3 vertices, total of 6 vertices
     constexpr int NUM_VERTS = 6;
-    Vertex_PCU    verts[NUM_VERTS];
+    Vertex_PCU*   verts     = batcher.Append(state, NUM_VERTS);
 
     // Set the vertices of triangle 1 (bottomLeft, bottomRight, topLeft)
     verts[0].m_position = bottomLeft;
@@ -219,14 +213,10 @@ void DebugDrawGlowBox(Vec2 const& center, Vec2 const& dimensions, Rgba8 const& c
             verts[i].m_color = glowColor;
         }
     }
-
-    // Draw the vertex array
-    g_renderer->BindTexture(nullptr);
-    g_renderer->DrawVertexArray(NUM_VERTS, &verts[0]);
 }
 
 //----------------------------------------------------------------------------------------------------
-void DebugDrawBoxRing(Vec2 const& center, float radius, float thickness, Rgba8 const& color)
+void DebugDrawBoxRing(RenderBatcher& batcher, Vec2 const& center, float radius, float thickness, Rgba8 const& color)
 {
     float halfThickness = 0.5f * thickness;
     float innerRadius   = radius - halfThickness;
@@ -244,7 +234,7 @@ void DebugDrawBoxRing(Vec2 const& center, float radius, float thickness, Rgba8 c
     Vec3 outerTopRight(center.x + outerRadius, center.y + outerRadius, 0.f);
 
     // Define 8 triangles to form the ring (each side of the square gets 2 triangles)
-    Vertex_PCU verts[24];  // 8 triangles * 3 vertices = 24
+    Vertex_PCU* verts = batcher.Append(sRenderState(), 24);  // 8 triangles * 3 vertices = 24
 
     // Bottom side (outerBottomLeft -> innerBottomLeft -> innerBottomRight -> outerBottomRight)
     verts[0].m_position = outerBottomLeft;
@@ -287,7 +277,4 @@ void DebugDrawBoxRing(Vec2 const& center, float radius, float thickness, Rgba8 c
     {
         verts[i].m_color = color;
     }
-
-    g_renderer->BindTexture(nullptr);
-    g_renderer->DrawVertexArray(24, &verts[0]);
 }
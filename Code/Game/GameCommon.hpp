@@ -8,8 +8,10 @@
 //----------------------------------------------------------------------------------------------------
 struct Rgba8;
 struct Vec2;
+struct sRenderState;
 class App;
 class Game;
+class RenderBatcher;
 
 // one-time declaration
 extern App*  g_app;
@@ -26,6 +28,12 @@ constexpr float SCREEN_SIZE_Y = 800.f;
 constexpr float WORLD_CENTER_X = WORLD_SIZE_X / 2.f;
 constexpr float WORLD_CENTER_Y = WORLD_SIZE_Y / 2.f;
 
+constexpr float COLLISION_GRID_CELL_SIZE   = 10.f; // divides the world evenly; at least twice the largest collider radius
+constexpr int   COLLISION_BULLETS_PER_TASK = 64;   // fixed, so how detection is split never depends on the thread count
+constexpr int   SWEEP_QUERIES_PER_TASK     = 32;   // same for batched sweep queries
+constexpr int   NEIGHBOR_QUERIES_PER_TASK  = 64;   // and for batched nearest-enemy queries
+constexpr int   RENDER_SHAPES_PER_TASK     = 256;  // and for generating the world verts of instances and debris
+
 //----------------------------------------------------------------------------------------------------
 // PlayerShip-related
 //
@@ -53,13 +61,14 @@ extern Rgba8 const BULLET_RED_TRANSPARENT;
 //----------------------------------------------------------------------------------------------------
 // Asteroid-related
 //
-constexpr int      STARTING_ASTEROIDS_NUM   = 6;
-constexpr int      MAX_ASTEROIDS_NUM        = 30;
-constexpr int      ASTEROID_TRIS_NUM        = 16;
-constexpr int      ASTEROID_VERTS_NUM       = 3 * ASTEROID_TRIS_NUM;
-constexpr float    ASTEROID_SPEED           = 10.f;
-constexpr float    ASTEROID_PHYSICS_RADIUS  = 1.6f;
-constexpr float    ASTEROID_COSMETIC_RADIUS = 2.0f;
+constexpr int      STARTING_ASTEROIDS_NUM    = 6;
+constexpr int      MAX_ASTEROIDS_NUM         = 30;
+constexpr int      ASTEROID_TRIS_NUM         = 16;
+constexpr int      ASTEROID_VERTS_NUM        = 3 * ASTEROID_TRIS_NUM;
+constexpr float    ASTEROID_SPEED            = 10.f;
+constexpr float    ASTEROID_PHYSICS_RADIUS   = 1.6f;
+constexpr float    ASTEROID_COSMETIC_RADIUS  = 2.0f;
+constexpr int      ASTEROID_MESH_VARIANT_NUM = 16;
 extern Rgba8 const ASTEROID_COLOR;
 
 //----------------------------------------------------------------------------------------------------
@@ -84,29 +93,48 @@ extern Rgba8 const WASP_COLOR;
 //----------------------------------------------------------------------------------------------------
 // Debris-related
 //
-// #TODO: fix
 constexpr int   MAX_DEBRIS_NUM            = 200000;
 constexpr int   DEBRIS_TRI_NUM            = 8;
 constexpr int   DEBRIS_VERTS_NUM          = 3 * DEBRIS_TRI_NUM;
+constexpr int   DEBRIS_RENDER_RESERVE_NUM = 4096;
+constexpr float DEBRIS_LIFETIME_SECONDS   = 2.f;
 constexpr float ENTITY_HIT_DEBRIS_RADIUS  = 0.1f;
 constexpr float ENTITY_DEAD_DEBRIS_RADIUS = 0.3f;
+constexpr int   DEBRIS_MESH_VARIANT_NUM   = 64;
 
 //----------------------------------------------------------------------------------------------------
 // Box-related
 //
-constexpr int   MAX_BOX_NUM     = 10000;
-constexpr int   BOX_TRI_NUM     = 2;
-constexpr int   BOX_VERTS_NUM   = 3 * BOX_TRI_NUM;
-constexpr float BOX_SIDE_LENGTH = 4.f;
+constexpr int   BOX_TRI_NUM           = 2;
+constexpr int   BOX_VERTS_NUM         = 3 * BOX_TRI_NUM;
+constexpr float BOX_SIDE_LENGTH       = 4.f;
+constexpr int   BOX_HEALTH            = 5;
+constexpr int   BOX_HIT_SCORE         = 1;
+constexpr int   BOX_KILL_SCORE        = 1;
+constexpr int   BOX_HIT_DEBRIS_NUM    = 3;
+constexpr int   BOX_DEATH_DEBRIS_NUM  = 12;
+constexpr float BOX_WALL_PITCH        = BOX_SIDE_LENGTH * 1.1f; // lattice spacing, in x and y
+constexpr int   BOX_WALL_STACK_HEIGHT = 10;                     // most boxes in a column's top or bottom stack
+constexpr int   BOX_WALL_ROW_NUM      = 2 * BOX_WALL_STACK_HEIGHT;
+constexpr float BOX_WALL_STEP_SECONDS = 1.f;                    // one column enters, and the wall steps left one pitch
+
+extern Rgba8 const BOX_COLOR;
+
+//----------------------------------------------------------------------------------------------------
+// Render-related
+//
+constexpr int RENDER_BATCH_RESERVE_NUM = 16; // state runs per frame the world pass is expected to need
 
 //----------------------------------------------------------------------------------------------------
 // DebugRender-related
 //
-void DebugDrawRing(Vec2 const& center, float radius, float thickness, Rgba8 const& color);
-void DebugDrawLine(Vec2 const& start, Vec2 const& end, float thickness, Rgba8 const& color);
-void DebugDrawGlowCircle(Vec2 const& center, float radius, Rgba8 const& color, float glowIntensity);
-void DebugDrawGlowBox(Vec2 const& center, Vec2 const& dimensions, Rgba8 const& color, float glowIntensity);
-void DebugDrawBoxRing(Vec2 const& center, float radius, float thickness, Rgba8 const& color);
+// Shapes are queued on 'batcher' under the camera and layer it has set. The glow shapes also serve
+// the UI, so they take the state to draw with; the rest use the world pass's.
+void DebugDrawRing(RenderBatcher& batcher, Vec2 const& center, float radius, float thickness, Rgba8 const& color);
+void DebugDrawLine(RenderBatcher& batcher, Vec2 const& start, Vec2 const& end, float thickness, Rgba8 const& color);
+void DebugDrawGlowCircle(RenderBatcher& batcher, sRenderState const& state, Vec2 const& center, float radius, Rgba8 const& color, float glowIntensity);
+void DebugDrawGlowBox(RenderBatcher& batcher, sRenderState const& state, Vec2 const& center, Vec2 const& dimensions, Rgba8 const& color, float glowIntensity);
+void DebugDrawBoxRing(RenderBatcher& batcher, Vec2 const& center, float radius, float thickness, Rgba8 const& color);
 
 extern Rgba8 const DEBUG_RENDER_GREY;
 extern Rgba8 const DEBUG_RENDER_RED;
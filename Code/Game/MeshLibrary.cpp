@@ -0,0 +1,232 @@
+//----------------------------------------------------------------------------------------------------
+// MeshLibrary.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/MeshLibrary.hpp"
+//----------------------------------------------------------------------------------------------------
+#include "Game/GameCommon.hpp"
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Math/RandomNumberGenerator.hpp"
+
+//----------------------------------------------------------------------------------------------------
+// Instances store their variant as a uint8_t
+static_assert(ASTEROID_MESH_VARIANT_NUM <= 256 && DEBRIS_MESH_VARIANT_NUM <= 256);
+
+//----------------------------------------------------------------------------------------------------
+MeshLibrary::MeshLibrary(int const numAsteroidVariants, int const numDebrisVariants)
+    : m_numAsteroidVariants(numAsteroidVariants),
+      m_numDebrisVariants(numDebrisVariants)
+{
+    InitializeFixedMeshes();
+
+    // Radii match the old per-instance rolls, expressed as a fraction of the cosmetic radius
+    constexpr float asteroidMinRadius = ASTEROID_PHYSICS_RADIUS / ASTEROID_COSMETIC_RADIUS;
+    constexpr float debrisMinRadius   = 0.25f / 1.5f;
+    constexpr float debrisMaxRadius   = 0.75f;
+
+    constexpr float asteroidDegreesPerSide = 360.f / static_cast<float>(ASTEROID_TRIS_NUM);
+    constexpr float debrisDegreesPerSide   = 360.f / static_cast<float>(DEBRIS_TRI_NUM);
+
+    m_asteroidVerts.reserve(static_cast<size_t>(numAsteroidVariants) * ASTEROID_VERTS_NUM);
+
+    for (int variantIndex = 0; variantIndex < numAsteroidVariants; ++variantIndex)
+    {
+        Vec2 rimPoints[ASTEROID_TRIS_NUM];
+
+        for (int sideIndex = 0; sideIndex < ASTEROID_TRIS_NUM; ++sideIndex)
+        {
+            float const radius  = g_rng->RollRandomFloatInRange(asteroidMinRadius, 1.f);
+            float const degrees = asteroidDegreesPerSide * static_cast<float>(sideIndex);
+
+            rimPoints[sideIndex] = Vec2(radius * CosDegrees(degrees), radius * SinDegrees(degrees));
+        }
+
+        for (int sideIndex = 0; sideIndex < ASTEROID_TRIS_NUM; ++sideIndex)
+        {
+            Vec2 const secondVert = rimPoints[sideIndex];
+            Vec2 const thirdVert  = rimPoints[(sideIndex + 1) % ASTEROID_TRIS_NUM];
+
+            m_asteroidVerts.emplace_back(Vec3(0.f, 0.f, 0.f), Rgba8::WHITE);
+            m_asteroidVerts.emplace_back(Vec3(secondVert.x, secondVert.y, 0.f), Rgba8::WHITE);
+            m_asteroidVerts.emplace_back(Vec3(thirdVert.x, thirdVert.y, 0.f), Rgba8::WHITE);
+        }
+    }
+
+    m_debrisRimPoints.reserve(static_cast<size_t>(numDebrisVariants) * DEBRIS_TRI_NUM);
+
+    for (int variantIndex = 0; variantIndex < numDebrisVariants; ++variantIndex)
+    {
+        for (int sideIndex = 0; sideIndex < DEBRIS_TRI_NUM; ++sideIndex)
+        {
+            float const radius  = g_rng->RollRandomFloatInRange(debrisMinRadius, debrisMaxRadius);
+            float const degrees = debrisDegreesPerSide * static_cast<float>(sideIndex);
+
+            m_debrisRimPoints.push_back(Vec2::MakeFromPolarDegrees(degrees, radius));
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+Vertex_PCU const* MeshLibrary::GetPlayerShipVerts() const
+{
+    return m_playerShipVerts;
+}
+
+//----------------------------------------------------------------------------------------------------
+Vertex_PCU const* MeshLibrary::GetBulletVerts() const
+{
+    return m_bulletVerts;
+}
+
+//----------------------------------------------------------------------------------------------------
+Vertex_PCU const* MeshLibrary::GetBeetleVerts() const
+{
+    return m_beetleVerts;
+}
+
+//----------------------------------------------------------------------------------------------------
+Vertex_PCU const* MeshLibrary::GetWaspVerts() const
+{
+    return m_waspVerts;
+}
+
+//----------------------------------------------------------------------------------------------------
+Vertex_PCU const* MeshLibrary::GetBoxVerts() const
+{
+    return m_boxVerts;
+}
+
+//----------------------------------------------------------------------------------------------------
+int MeshLibrary::GetNumAsteroidVariants() const
+{
+    return m_numAsteroidVariants;
+}
+
+//----------------------------------------------------------------------------------------------------
+int MeshLibrary::GetNumDebrisVariants() const
+{
+    return m_numDebrisVariants;
+}
+
+//----------------------------------------------------------------------------------------------------
+Vertex_PCU const* MeshLibrary::GetAsteroidVerts(int const variantIndex) const
+{
+    return &m_asteroidVerts[static_cast<size_t>(variantIndex) * ASTEROID_VERTS_NUM];
+}
+
+//----------------------------------------------------------------------------------------------------
+Vec2 const* MeshLibrary::GetDebrisRimPoints(int const variantIndex) const
+{
+    return &m_debrisRimPoints[static_cast<size_t>(variantIndex) * DEBRIS_TRI_NUM];
+}
+
+//----------------------------------------------------------------------------------------------------
+Vertex_PCU const* MeshLibrary::GetVerts(eMeshId const meshId, int const variantIndex) const
+{
+    switch (meshId)
+    {
+    case eMeshId::PLAYER_SHIP: return m_playerShipVerts;
+    case eMeshId::BULLET: return m_bulletVerts;
+    case eMeshId::ASTEROID: return GetAsteroidVerts(variantIndex);
+    case eMeshId::BEETLE: return m_beetleVerts;
+    case eMeshId::WASP: return m_waspVerts;
+    }
+
+    return nullptr;
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC int MeshLibrary::GetNumVerts(eMeshId const meshId)
+{
+    switch (meshId)
+    {
+    case eMeshId::PLAYER_SHIP: return PLAYER_SHIP_VERTS_NUM;
+    case eMeshId::BULLET: return BULLET_VERTS_NUM;
+    case eMeshId::ASTEROID: return ASTEROID_VERTS_NUM;
+    case eMeshId::BEETLE: return BEETLE_VERTS_NUM;
+    case eMeshId::WASP: return WASP_VERTS_NUM;
+    }
+
+    return 0;
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC bool MeshLibrary::IsPreColored(eMeshId const meshId)
+{
+    return meshId == eMeshId::BULLET;
+}
+
+//----------------------------------------------------------------------------------------------------
+void MeshLibrary::InitializeFixedMeshes()
+{
+    m_playerShipVerts[0].m_position = Vec3(-2.f, 1.f, 0.f);
+    m_playerShipVerts[1].m_position = Vec3(2.f, 1.f, 0.f);
+    m_playerShipVerts[2].m_position = Vec3(0.f, 2.f, 0.f);
+
+    m_playerShipVerts[3].m_position = Vec3(0.f, 1.f, 0.f);
+    m_playerShipVerts[4].m_position = Vec3(-2.f, 1.f, 0.f);
+    m_playerShipVerts[5].m_position = Vec3(-2.f, -1.f, 0.f);
+
+    m_playerShipVerts[6].m_position = Vec3(0.f, 1.f, 0.f);
+    m_playerShipVerts[7].m_position = Vec3(-2.f, -1.f, 0.f);
+    m_playerShipVerts[8].m_position = Vec3(0.f, -1.f, 0.f);
+
+    m_playerShipVerts[9].m_position  = Vec3(1.f, 0.f, 0.f);
+    m_playerShipVerts[10].m_position = Vec3(0.f, 1.f, 0.f);
+    m_playerShipVerts[11].m_position = Vec3(0.f, -1.f, 0.f);
+
+    m_playerShipVerts[12].m_position = Vec3(2.f, -1.f, 0.f);
+    m_playerShipVerts[13].m_position = Vec3(-2.f, -1.f, 0.f);
+    m_playerShipVerts[14].m_position = Vec3(0.f, -2.f, 0.f);
+
+    m_bulletVerts[0].m_position = Vec3(0.f, 0.5f, 0.f);
+    m_bulletVerts[1].m_position = Vec3(0.f, -0.5f, 0.f);
+    m_bulletVerts[2].m_position = Vec3(0.5f, 0.f, 0.f);
+
+    m_bulletVerts[3].m_position = Vec3(0.f, 0.5f, 0.f);
+    m_bulletVerts[4].m_position = Vec3(-2.f, 0.f, 0.f);
+    m_bulletVerts[5].m_position = Vec3(0.f, -0.5f, 0.f);
+
+    m_bulletVerts[0].m_color = BULLET_YELLOW_OPAQUE;
+    m_bulletVerts[1].m_color = BULLET_YELLOW_OPAQUE;
+    m_bulletVerts[2].m_color = BULLET_YELLOW_OPAQUE;
+
+    m_bulletVerts[3].m_color = BULLET_RED_OPAQUE;
+    m_bulletVerts[4].m_color = BULLET_RED_TRANSPARENT;
+    m_bulletVerts[5].m_color = BULLET_RED_OPAQUE;
+
+    m_beetleVerts[0].m_position = Vec3(1.5f, 1.f, 0.f);
+    m_beetleVerts[1].m_position = Vec3(-1.5f, 2.f, 0.f);
+    m_beetleVerts[2].m_position = Vec3(1.5f, -1.f, 0.f);
+
+    m_beetleVerts[3].m_position = Vec3(1.5f, -1.f, 0.f);
+    m_beetleVerts[4].m_position = Vec3(-1.5f, 2.f, 0.f);
+    m_beetleVerts[5].m_position = Vec3(-1.5f, -2.f, 0.f);
+
+    m_waspVerts[0].m_position = Vec3(2.f, 0.f, 0.f);
+    m_waspVerts[1].m_position = Vec3(0.f, 2.f, 0.f);
+    m_waspVerts[2].m_position = Vec3(0.f, 1.f, 0.f);
+
+    m_waspVerts[3].m_position = Vec3(2.f, 0.f, 0.f);
+    m_waspVerts[4].m_position = Vec3(0.f, 1.f, 0.f);
+    m_waspVerts[5].m_position = Vec3(-2.f, 0.f, 0.f);
+
+    m_waspVerts[6].m_position = Vec3(2.f, 0.f, 0.f);
+    m_waspVerts[7].m_position = Vec3(-2.f, 0.f, 0.f);
+    m_waspVerts[8].m_position = Vec3(0.f, -1.f, 0.f);
+
+    m_waspVerts[9].m_position  = Vec3(2.f, 0.f, 0.f);
+    m_waspVerts[10].m_position = Vec3(0.f, -1.f, 0.f);
+    m_waspVerts[11].m_position = Vec3(0.f, -2.f, 0.f);
+
+    m_boxVerts[0].m_position = Vec3(0.f, 0.f, 0.f);
+    m_boxVerts[1].m_position = Vec3(BOX_SIDE_LENGTH, 0.f, 0.f);
+    m_boxVerts[2].m_position = Vec3(0.f, BOX_SIDE_LENGTH, 0.f);
+
+    m_boxVerts[3].m_position = Vec3(0.f, BOX_SIDE_LENGTH, 0.f);
+    m_boxVerts[4].m_position = Vec3(BOX_SIDE_LENGTH, 0.f, 0.f);
+    m_boxVerts[5].m_position = Vec3(BOX_SIDE_LENGTH, BOX_SIDE_LENGTH, 0.f);
+}
@@ -0,0 +1,61 @@
+//----------------------------------------------------------------------------------------------------
+// MeshLibrary.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+//----------------------------------------------------------------------------------------------------
+#include "Game/EcsComponents.hpp"
+#include "Game/GameCommon.hpp"
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Renderer/Vertex_PCU.hpp"
+//----------------------------------------------------------------------------------------------------
+#include <vector>
+
+//----------------------------------------------------------------------------------------------------
+// Immutable render data shared by every entity of a type, kept out of the per-entity records.
+// Fixed shapes (ship, bullet, beetle, wasp, box) are stored once in local space. Asteroid and debris
+// shapes are random variants built at startup at unit cosmetic radius; instances only keep a variant
+// index and scale them by their own cosmetic radius when rendering.
+// Verts are white unless noted; Render tints them with the entity's color.
+//
+class MeshLibrary
+{
+public:
+    MeshLibrary(int numAsteroidVariants, int numDebrisVariants);
+
+    Vertex_PCU const* GetPlayerShipVerts() const;
+    Vertex_PCU const* GetBulletVerts() const; // already colored
+    Vertex_PCU const* GetBeetleVerts() const;
+    Vertex_PCU const* GetWaspVerts() const;
+    Vertex_PCU const* GetBoxVerts() const;    // bottom-left corner at the origin
+
+    int GetNumAsteroidVariants() const;
+    int GetNumDebrisVariants() const;
+
+    // ASTEROID_VERTS_NUM white local verts, unit cosmetic radius
+    Vertex_PCU const* GetAsteroidVerts(int variantIndex) const;
+
+    // DEBRIS_TRI_NUM rim points around the origin, unit cosmetic radius
+    Vec2 const* GetDebrisRimPoints(int variantIndex) const;
+
+    // Lookup by sMeshRef; variantIndex is ignored by meshes without variants
+    Vertex_PCU const* GetVerts(eMeshId meshId, int variantIndex) const;
+    static int        GetNumVerts(eMeshId meshId);
+    static bool       IsPreColored(eMeshId meshId);
+
+private:
+    void InitializeFixedMeshes();
+
+    Vertex_PCU m_playerShipVerts[PLAYER_SHIP_VERTS_NUM];
+    Vertex_PCU m_bulletVerts[BULLET_VERTS_NUM];
+    Vertex_PCU m_beetleVerts[BEETLE_VERTS_NUM];
+    Vertex_PCU m_waspVerts[WASP_VERTS_NUM];
+    Vertex_PCU m_boxVerts[BOX_VERTS_NUM];
+
+    int m_numAsteroidVariants = 0;
+    int m_numDebrisVariants   = 0;
+
+    std::vector<Vertex_PCU> m_asteroidVerts;
+    std::vector<Vec2>       m_debrisRimPoints;
+};
@@ -0,0 +1,85 @@
+//----------------------------------------------------------------------------------------------------
+// PoolConfig.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/PoolConfig.hpp"
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Core/DevConsole.hpp"
+#include "Engine/Core/StringUtils.hpp"
+//----------------------------------------------------------------------------------------------------
+#include "ThirdParty/json/json.hpp"
+//----------------------------------------------------------------------------------------------------
+#include <fstream>
+
+#if defined ERROR
+#undef ERROR
+#endif
+
+//----------------------------------------------------------------------------------------------------
+char const* const POOL_CONFIG_PATH = "Data/Config/PoolCapacities.json";
+
+//----------------------------------------------------------------------------------------------------
+static void ReadCapacity(nlohmann::json const& capacities, char const* filePath, char const* key, int const maxCapacity, int& out_capacity)
+{
+    auto const found = capacities.find(key);
+
+    if (found == capacities.end()) return;
+
+    if (!found->is_number_integer() || found->get<long long>() <= 0 || found->get<long long>() > maxCapacity)
+    {
+        g_devConsole->AddLine(DevConsole::ERROR,
+                              Stringf("%s: \"%s\" must be an integer in [1, %d]; keeping %d", filePath, key, maxCapacity, out_capacity));
+        return;
+    }
+
+    out_capacity = found->get<int>();
+}
+
+//----------------------------------------------------------------------------------------------------
+sPoolCapacities LoadPoolCapacities(char const* const filePath)
+{
+    sPoolCapacities capacities;
+    std::ifstream   file(filePath);
+
+    if (!file.is_open())
+    {
+        g_devConsole->AddLine(DevConsole::INFO_MINOR, Stringf("%s not found; using default pool capacities", filePath));
+        return capacities;
+    }
+
+    nlohmann::json const root = nlohmann::json::parse(file, nullptr, false);
+
+    if (root.is_discarded() || !root.is_object() || !root.contains("capacities") || !root.at("capacities").is_object())
+    {
+        g_devConsole->AddLine(DevConsole::ERROR, Stringf("%s has no \"capacities\" object; using default pool capacities", filePath));
+        return capacities;
+    }
+
+    nlohmann::json const& entries = root.at("capacities");
+
+    ReadCapacity(entries, filePath, "bullets", POOL_MAX_ENTITY_NUM, capacities.m_bullets);
+    ReadCapacity(entries, filePath, "asteroids", POOL_MAX_ENTITY_NUM, capacities.m_asteroids);
+    ReadCapacity(entries, filePath, "beetles", POOL_MAX_ENTITY_NUM, capacities.m_beetles);
+    ReadCapacity(entries, filePath, "wasps", POOL_MAX_ENTITY_NUM, capacities.m_wasps);
+    ReadCapacity(entries, filePath, "debris", POOL_MAX_DEBRIS_NUM, capacities.m_debris);
+
+    // Each fits on its own, but EcsWorld needs a distinct handle index for every entity of every pool
+    long long const numEntities = static_cast<long long>(capacities.m_bullets) + capacities.m_asteroids + capacities.m_beetles + capacities.m_wasps;
+
+    if (numEntities > POOL_MAX_ENTITY_NUM)
+    {
+        g_devConsole->AddLine(DevConsole::ERROR,
+                              Stringf("%s: entity capacities add up to %lld, more than the %d EntityHandle can index; using default entity capacities",
+                                      filePath, numEntities, POOL_MAX_ENTITY_NUM));
+
+        sPoolCapacities const defaults;
+
+        capacities.m_bullets   = defaults.m_bullets;
+        capacities.m_asteroids = defaults.m_asteroids;
+        capacities.m_beetles   = defaults.m_beetles;
+        capacities.m_wasps     = defaults.m_wasps;
+    }
+
+    return capacities;
+}
@@ -0,0 +1,31 @@
+//----------------------------------------------------------------------------------------------------
+// PoolConfig.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+//----------------------------------------------------------------------------------------------------
+#include "Game/EntityHandle.hpp"
+#include "Game/GameCommon.hpp"
+
+//----------------------------------------------------------------------------------------------------
+// Capacity of every fixed-size pool, read once when the Game is constructed. Keys missing from the
+// file keep the GameCommon.hpp MAX_*_NUM defaults, so an absent file gives the built-in budget.
+// Entity pools together must fit in an EntityHandle's index beside the player ship, or they all fall
+// back to their defaults.
+//
+struct sPoolCapacities
+{
+    int m_bullets   = MAX_BULLETS_NUM;
+    int m_asteroids = MAX_ASTEROIDS_NUM;
+    int m_beetles   = MAX_BEETLE_NUM;
+    int m_wasps     = MAX_WASP_NUM;
+    int m_debris    = MAX_DEBRIS_NUM;
+};
+
+constexpr int POOL_MAX_ENTITY_NUM = static_cast<int>(EntityHandle::INDEX_MASK) - 1; // bullets, asteroids, beetles and wasps together
+constexpr int POOL_MAX_DEBRIS_NUM = 1 << 22;
+
+extern char const* const POOL_CONFIG_PATH;
+
+sPoolCapacities LoadPoolCapacities(char const* filePath);
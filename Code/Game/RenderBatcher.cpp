@@ -0,0 +1,355 @@
+//----------------------------------------------------------------------------------------------------
+// RenderBatcher.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/RenderBatcher.hpp"
+//----------------------------------------------------------------------------------------------------
+#include "Game/GameCommon.hpp"
+#include "Game/WorkerPool.hpp"
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Math/MathUtils.hpp"
+//----------------------------------------------------------------------------------------------------
+#include <algorithm>
+#include <cfloat>
+#include <tuple>
+
+//----------------------------------------------------------------------------------------------------
+constexpr int RENDER_STATE_FIELD_NUM = 5; // sRenderState members BindState compares
+
+//----------------------------------------------------------------------------------------------------
+// Texture pointers only need to group, so any consistent order among them will do.
+//
+static auto GetRenderStateSortKey(sRenderState const& state)
+{
+    return std::make_tuple(state.m_blendMode, state.m_rasterizerMode, state.m_samplerMode, state.m_depthMode, reinterpret_cast<uintptr_t>(state.m_texture));
+}
+
+//----------------------------------------------------------------------------------------------------
+void ExpandShapeInstances(Vertex_PCU const* localVerts, int const numVerts, bool const isPreColored,
+                          sShapeInstance const* instances, int const numInstances, Vertex_PCU* out_verts)
+{
+    for (int instanceIndex = 0; instanceIndex < numInstances; ++instanceIndex)
+    {
+        sShapeInstance const& instance = instances[instanceIndex];
+        float const           cosine   = CosDegrees(instance.m_orientationDegrees) * instance.m_scale;
+        float const           sine     = SinDegrees(instance.m_orientationDegrees) * instance.m_scale;
+
+        for (int vertIndex = 0; vertIndex < numVerts; ++vertIndex)
+        {
+            Vertex_PCU const& local = localVerts[vertIndex];
+
+            out_verts[vertIndex] = Vertex_PCU(Vec3(instance.m_position.x + local.m_position.x * cosine - local.m_position.y * sine,
+                                                   instance.m_position.y + local.m_position.x * sine + local.m_position.y * cosine,
+                                                   local.m_position.z * instance.m_scale),
+                                              isPreColored ? local.m_color : instance.m_color,
+                                              local.m_uvTexCoords);
+        }
+
+        out_verts += numVerts;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+RenderBatcher::RenderBatcher()
+{
+    m_batches.reserve(RENDER_BATCH_RESERVE_NUM);
+    m_instanceRuns.reserve(RENDER_BATCH_RESERVE_NUM);
+}
+
+//----------------------------------------------------------------------------------------------------
+// Bullets and boxes are the smallest instanced meshes, so a stream of numVerts never holds more
+// instances than that many of them.
+//
+void RenderBatcher::Reserve(int const numVerts)
+{
+    m_verts.reserve(static_cast<size_t>(numVerts));
+    m_instances.reserve(static_cast<size_t>(numVerts) / BULLET_VERTS_NUM);
+}
+
+//----------------------------------------------------------------------------------------------------
+void RenderBatcher::Begin()
+{
+    m_verts.clear();
+    m_batches.clear();
+    m_instances.clear();
+    m_instanceRuns.clear();
+    m_cameras.clear();
+
+    m_numPlacedRuns   = 0;
+    m_cameraIndex     = 0;
+    m_layer           = eRenderLayer::WORLD;
+    m_cullBounds      = AABB2(Vec2(-FLT_MAX, -FLT_MAX), Vec2(FLT_MAX, FLT_MAX));
+    m_numCulled       = 0;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Pending instances are placed first, so they keep the camera and layer they were submitted under.
+//
+void RenderBatcher::SetCamera(Camera const& camera)
+{
+    PlacePendingInstances();
+
+    auto const found = std::find(m_cameras.begin(), m_cameras.end(), &camera);
+
+    m_cameraIndex = static_cast<int>(found - m_cameras.begin());
+
+    if (found == m_cameras.end()) m_cameras.push_back(&camera);
+}
+
+//----------------------------------------------------------------------------------------------------
+void RenderBatcher::SetLayer(eRenderLayer const layer)
+{
+    PlacePendingInstances();
+
+    m_layer = layer;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool RenderBatcher::IsDiscVisible(Vec2 const& center, float const radius) const
+{
+    return center.x + radius >= m_cullBounds.m_mins.x &&
+           center.x - radius <= m_cullBounds.m_maxs.x &&
+           center.y + radius >= m_cullBounds.m_mins.y &&
+           center.y - radius <= m_cullBounds.m_maxs.y;
+}
+
+//----------------------------------------------------------------------------------------------------
+int RenderBatcher::RegisterMesh(Vertex_PCU const* localVerts, int const numVerts, bool const isPreColored)
+{
+    m_meshes.push_back({static_cast<int>(m_meshVerts.size()), numVerts, isPreColored});
+    m_meshVerts.insert(m_meshVerts.end(), localVerts, localVerts + numVerts);
+
+    return static_cast<int>(m_meshes.size()) - 1;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Extends the last run when it is still pending and has the same mesh and state.
+//
+void RenderBatcher::AppendInstance(sRenderState const& state, int const meshIndex, sShapeInstance const& instance)
+{
+    bool const canExtend = static_cast<int>(m_instanceRuns.size()) > m_numPlacedRuns &&
+                           m_instanceRuns.back().m_meshIndex == meshIndex &&
+                           m_instanceRuns.back().m_state == state;
+
+    if (!canExtend)
+    {
+        m_instanceRuns.push_back({state, meshIndex, static_cast<int>(m_instances.size()), 0});
+    }
+
+    m_instances.push_back(instance);
+    ++m_instanceRuns.back().m_numInstances;
+}
+
+//----------------------------------------------------------------------------------------------------
+Vertex_PCU* RenderBatcher::Append(sRenderState const& state, int const numVerts)
+{
+    PlacePendingInstances();
+
+    return AppendVerts(state, numVerts);
+}
+
+//----------------------------------------------------------------------------------------------------
+// Only makes room for the runs' verts; ExpandInstances fills it in.
+//
+void RenderBatcher::PlacePendingInstances()
+{
+    for (; m_numPlacedRuns < static_cast<int>(m_instanceRuns.size()); ++m_numPlacedRuns)
+    {
+        sInstanceRun&         run  = m_instanceRuns[m_numPlacedRuns];
+        sInstancedMesh const& mesh = m_meshes[run.m_meshIndex];
+
+        run.m_firstVert = static_cast<int>(AppendVerts(run.m_state, mesh.m_numVerts * run.m_numInstances) - m_verts.data());
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// Tasks cover fixed ranges of the frame's instances whatever the thread count, and each writes only
+// the verts of its own instances, which never move once placed.
+//
+void RenderBatcher::ExpandInstances(WorkerPool& workerPool)
+{
+    PlacePendingInstances();
+
+    int const numInstances = static_cast<int>(m_instances.size());
+    int const numTasks     = (numInstances + RENDER_SHAPES_PER_TASK - 1) / RENDER_SHAPES_PER_TASK;
+
+    workerPool.ParallelFor(numTasks, [this, numInstances](int const taskIndex)
+    {
+        int const firstInstance = taskIndex * RENDER_SHAPES_PER_TASK;
+
+        ExpandInstanceRange(firstInstance, std::min(firstInstance + RENDER_SHAPES_PER_TASK, numInstances));
+    });
+}
+
+//----------------------------------------------------------------------------------------------------
+// A range may start inside one run and end inside another; runs are in instance order, so the first
+// one is found by binary search.
+//
+void RenderBatcher::ExpandInstanceRange(int const firstInstance, int const endInstance)
+{
+    auto run = std::upper_bound(m_instanceRuns.begin(), m_instanceRuns.end(), firstInstance, [](int const instanceIndex, sInstanceRun const& other)
+    {
+        return instanceIndex < other.m_firstInstance;
+    }) - 1;
+
+    for (int instanceIndex = firstInstance; instanceIndex < endInstance; ++run)
+    {
+        sInstancedMesh const& mesh         = m_meshes[run->m_meshIndex];
+        int const             indexInRun   = instanceIndex - run->m_firstInstance;
+        int const             numInstances = std::min(endInstance, run->m_firstInstance + run->m_numInstances) - instanceIndex;
+
+        ExpandShapeInstances(m_meshVerts.data() + mesh.m_firstVert, mesh.m_numVerts, mesh.m_isPreColored,
+                             m_instances.data() + instanceIndex, numInstances,
+                             m_verts.data() + run->m_firstVert + indexInRun * mesh.m_numVerts);
+
+        instanceIndex += numInstances;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+Vertex_PCU* RenderBatcher::AppendVerts(sRenderState const& state, int const numVerts)
+{
+    int const firstVert = static_cast<int>(m_verts.size());
+
+    if (m_verts.size() + numVerts > m_verts.capacity()) ++m_numGrowths;
+
+    m_verts.resize(m_verts.size() + numVerts);
+
+    bool const canExtend = !m_batches.empty() &&
+                           m_batches.back().m_state == state &&
+                           m_batches.back().m_cameraIndex == m_cameraIndex &&
+                           m_batches.back().m_layer == m_layer;
+
+    if (!canExtend)
+    {
+        m_batches.push_back({state, static_cast<uint8_t>(m_cameraIndex), m_layer, firstVert, 0});
+    }
+
+    m_batches.back().m_numVerts += numVerts;
+
+    return m_verts.data() + firstVert;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Other code (the dev console, for one) draws between Flushes, so the first batch binds every field.
+// The renderer's state is left as the last batch set it.
+//
+void RenderBatcher::Flush(WorkerPool& workerPool)
+{
+    ExpandInstances(workerPool);
+
+    m_lastFrameStats                   = sRenderBatcherStats();
+    m_lastFrameStats.m_numBatches      = static_cast<int>(m_batches.size());
+    m_lastFrameStats.m_numInstances    = static_cast<int>(m_instances.size());
+    m_lastFrameStats.m_numInstanceRuns = static_cast<int>(m_instanceRuns.size());
+    m_lastFrameStats.m_numCulled       = m_numCulled;
+    m_lastFrameStats.m_numGrowths      = m_numGrowths;
+
+    std::stable_sort(m_batches.begin(), m_batches.end(), [](sBatch const& a, sBatch const& b)
+    {
+        if (a.m_cameraIndex != b.m_cameraIndex) return a.m_cameraIndex < b.m_cameraIndex;
+        if (a.m_layer != b.m_layer) return a.m_layer < b.m_layer;
+
+        return GetRenderStateSortKey(a.m_state) < GetRenderStateSortKey(b.m_state);
+    });
+
+    int  cameraIndex       = -1;
+    bool isBoundStateKnown = false;
+    int  batchIndex        = 0;
+    int  numBatches        = static_cast<int>(m_batches.size());
+
+    while (batchIndex < numBatches)
+    {
+        sBatch const& batch = m_batches[batchIndex];
+
+        if (batch.m_cameraIndex != cameraIndex)
+        {
+            if (cameraIndex >= 0) g_renderer->EndCamera(*m_cameras[cameraIndex]);
+
+            cameraIndex = batch.m_cameraIndex;
+            g_renderer->BeginCamera(*m_cameras[cameraIndex]);
+            g_renderer->SetModelConstants();
+            ++m_lastFrameStats.m_numCameraChanges;
+        }
+
+        BindState(batch.m_state, isBoundStateKnown);
+        isBoundStateKnown = true;
+
+        // Sorting may have brought batches that continue each other in the stream back together
+        int numVerts = batch.m_numVerts;
+
+        for (++batchIndex; batchIndex < numBatches; ++batchIndex)
+        {
+            sBatch const& next = m_batches[batchIndex];
+
+            if (next.m_cameraIndex != cameraIndex || !(next.m_state == batch.m_state) || next.m_firstVert != batch.m_firstVert + numVerts) break;
+
+            numVerts += next.m_numVerts;
+        }
+
+        if (numVerts == 0) continue;
+
+        g_renderer->DrawVertexArray(numVerts, m_verts.data() + batch.m_firstVert);
+
+        ++m_lastFrameStats.m_numDrawCalls;
+        m_lastFrameStats.m_numVerts += numVerts;
+    }
+
+    if (cameraIndex >= 0) g_renderer->EndCamera(*m_cameras[cameraIndex]);
+}
+
+//----------------------------------------------------------------------------------------------------
+// Compared field by field, so a texture change alone costs one BindTexture and nothing else.
+//
+void RenderBatcher::BindState(sRenderState const& state, bool const isBoundStateKnown)
+{
+    int numSets = 0;
+
+    if (!isBoundStateKnown || state.m_blendMode != m_boundState.m_blendMode)
+    {
+        g_renderer->SetBlendMode(state.m_blendMode);
+        ++numSets;
+    }
+
+    if (!isBoundStateKnown || state.m_rasterizerMode != m_boundState.m_rasterizerMode)
+    {
+        g_renderer->SetRasterizerMode(state.m_rasterizerMode);
+        ++numSets;
+    }
+
+    if (!isBoundStateKnown || state.m_samplerMode != m_boundState.m_samplerMode)
+    {
+        g_renderer->SetSamplerMode(state.m_samplerMode);
+        ++numSets;
+    }
+
+    if (!isBoundStateKnown || state.m_depthMode != m_boundState.m_depthMode)
+    {
+        g_renderer->SetDepthMode(state.m_depthMode);
+        ++numSets;
+    }
+
+    if (!isBoundStateKnown || state.m_texture != m_boundState.m_texture)
+    {
+        g_renderer->BindTexture(state.m_texture);
+        ++numSets;
+    }
+
+    m_boundState = state;
+
+    m_lastFrameStats.m_numStateSets          += numSets;
+    m_lastFrameStats.m_numRedundantStateSets += RENDER_STATE_FIELD_NUM - numSets;
+}
+
+//----------------------------------------------------------------------------------------------------
+size_t RenderBatcher::GetNumBytesReserved() const
+{
+    return m_verts.capacity() * sizeof(Vertex_PCU) +
+           m_batches.capacity() * sizeof(sBatch) +
+           m_cameras.capacity() * sizeof(Camera const*) +
+           m_meshVerts.capacity() * sizeof(Vertex_PCU) +
+           m_meshes.capacity() * sizeof(sInstancedMesh) +
+           m_instances.capacity() * sizeof(sShapeInstance) +
+           m_instanceRuns.capacity() * sizeof(sInstanceRun);
+}
@@ -0,0 +1,185 @@
+//----------------------------------------------------------------------------------------------------
+// RenderBatcher.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Core/Rgba8.hpp"
+#include "Engine/Math/AABB2.hpp"
+#include "Engine/Math/Vec2.hpp"
+#include "Engine/Renderer/Renderer.hpp"
+#include "Engine/Renderer/Vertex_PCU.hpp"
+//----------------------------------------------------------------------------------------------------
+#include <cstdint>
+#include <vector>
+
+//----------------------------------------------------------------------------------------------------
+class Camera;
+class Texture;
+class WorkerPool;
+
+//----------------------------------------------------------------------------------------------------
+// Everything that has to be bound before a draw. Batches that compare equal share one DrawVertexArray.
+// The defaults are the world pass's state; the screen-space UI draws with UI_RENDER_STATE.
+//
+struct sRenderState
+{
+    eBlendMode      m_blendMode      = eBlendMode::ALPHA;
+    eRasterizerMode m_rasterizerMode = eRasterizerMode::SOLID_CULL_BACK;
+    eSamplerMode    m_samplerMode    = eSamplerMode::POINT_CLAMP;
+    eDepthMode      m_depthMode      = eDepthMode::DISABLED;
+    Texture const*  m_texture        = nullptr;
+
+    bool operator==(sRenderState const& other) const = default;
+};
+
+inline sRenderState const UI_RENDER_STATE = {eBlendMode::ALPHA, eRasterizerMode::SOLID_CULL_NONE, eSamplerMode::POINT_CLAMP, eDepthMode::DISABLED, nullptr};
+
+//----------------------------------------------------------------------------------------------------
+// Within a camera, layers draw in this order whatever their state; only batches on the same layer
+// may be reordered to group their states.
+//
+enum class eRenderLayer : uint8_t
+{
+    WORLD,
+    WORLD_DEBUG,
+    UI_BACKGROUND,
+    UI_FOREGROUND
+};
+
+//----------------------------------------------------------------------------------------------------
+// Everything one copy of a registered mesh needs per frame, in place of its transformed verts.
+// Local verts are scaled, then rotated, then moved, as TransformVertexArrayXY3D does them.
+//
+struct sShapeInstance
+{
+    Vec2  m_position;
+    float m_orientationDegrees = 0.f;
+    float m_scale              = 1.f;
+    Rgba8 m_color;                    // replaces the verts' color unless the mesh is pre-colored
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sInstancedMesh
+{
+    int  m_firstVert    = 0; // into RenderBatcher's mesh verts
+    int  m_numVerts     = 0;
+    bool m_isPreColored = false;
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sRenderBatcherStats
+{
+    int m_numDrawCalls          = 0;
+    int m_numVerts              = 0;
+    int m_numBatches            = 0; // state runs as submitted, before sorting merged them
+    int m_numCameraChanges      = 0;
+    int m_numStateSets          = 0; // blend, rasterizer, sampler, depth and texture calls sent to the Renderer
+    int m_numRedundantStateSets = 0; // the same calls skipped because the value was already bound
+    int m_numInstances          = 0;
+    int m_numInstanceRuns       = 0; // consecutive instances of one mesh under one state
+    int m_numCulled             = 0; // shapes renderers skipped as outside the cull bounds
+    int m_numGrowths            = 0; // times the stream outgrew its reserve since construction
+};
+
+//----------------------------------------------------------------------------------------------------
+// The CPU side of instancing: writes numInstances * mesh's vert count world verts to out_verts,
+// instance by instance, with one sine and cosine per instance.
+//
+void ExpandShapeInstances(Vertex_PCU const* localVerts, int numVerts, bool isPreColored,
+                          sShapeInstance const* instances, int numInstances, Vertex_PCU* out_verts);
+
+//----------------------------------------------------------------------------------------------------
+// The frame's render queue: one vertex stream for every draw of the frame, kept between frames so it
+// stops allocating once it has reached its working size. Renderers append verts with a render state
+// between Begin() and Flush(), under the camera and layer last set; appends that keep the state of
+// the one before extend the same batch. Flush() stable-sorts the batches by camera (in the order the
+// cameras were first set), layer and state, draws runs of equal state that are adjacent in the
+// stream as one, and only sends the Renderer the state fields that differ from what it last bound.
+// Draws on one layer keep submission order among equal states but not across different ones.
+//
+// Shapes that many entities share are registered once as meshes and then submitted as one
+// sShapeInstance per copy. The engine's renderer has no instanced draw, so each run of instances
+// takes its place in the stream when the next Append or the Flush comes, and Flush expands all of the
+// frame's instances on the CPU at once, RENDER_SHAPES_PER_TASK per worker task, every task writing
+// its own slice of the stream; a renderer that can draw instances would take the runs and the records
+// as they are, with the same submission order.
+//
+class RenderBatcher
+{
+public:
+    RenderBatcher();
+
+    void Reserve(int numVerts);
+    void Begin();
+    void Flush(WorkerPool& workerPool); // also begins and ends each camera around its batches
+
+    void SetCamera(Camera const& camera);
+    void SetLayer(eRenderLayer layer);
+
+    // Rectangle the current camera shows, in its own space, for renderers to cull against; Begin() resets
+    // it to cover everything
+    void         SetCullBounds(AABB2 const& bounds) { m_cullBounds = bounds; }
+    AABB2 const& GetCullBounds() const { return m_cullBounds; }
+    bool         IsDiscVisible(Vec2 const& center, float radius) const; // conservative: tests the disc's bounding box
+    void         AddNumCulled(int numCulled) { m_numCulled += numCulled; }
+
+    // Room for numVerts verts at the end of the stream under 'state'; the pointer is only valid until
+    // the next Append
+    Vertex_PCU* Append(sRenderState const& state, int numVerts);
+
+    // Keeps a copy of the local verts for the batcher's lifetime and returns the index to instance them by
+    int  RegisterMesh(Vertex_PCU const* localVerts, int numVerts, bool isPreColored);
+    void AppendInstance(sRenderState const& state, int meshIndex, sShapeInstance const& instance);
+
+    // Writes the world verts of every instance since Begin() into their place in the stream. Flush
+    // calls it; the result is the same on any number of threads.
+    void ExpandInstances(WorkerPool& workerPool);
+
+    Vertex_PCU const* GetVerts() const { return m_verts.data(); } // the frame's stream so far, e.g. for benchmarks
+    int               GetNumVerts() const { return static_cast<int>(m_verts.size()); }
+
+    sRenderBatcherStats const& GetLastFrameStats() const { return m_lastFrameStats; }
+    size_t                     GetNumBytesReserved() const;
+
+private:
+    struct sBatch
+    {
+        sRenderState m_state;
+        uint8_t      m_cameraIndex = 0;
+        eRenderLayer m_layer       = eRenderLayer::WORLD;
+        int          m_firstVert   = 0;
+        int          m_numVerts    = 0;
+    };
+
+    struct sInstanceRun
+    {
+        sRenderState m_state;
+        int          m_meshIndex     = 0;
+        int          m_firstInstance = 0;
+        int          m_numInstances  = 0;
+        int          m_firstVert     = 0; // in m_verts, once placed
+    };
+
+    Vertex_PCU* AppendVerts(sRenderState const& state, int numVerts);
+    void        PlacePendingInstances();
+    void        ExpandInstanceRange(int firstInstance, int endInstance);
+    void        BindState(sRenderState const& state, bool isBoundStateKnown);
+
+    std::vector<Vertex_PCU>     m_verts;
+    std::vector<sBatch>         m_batches;
+    std::vector<Camera const*>  m_cameras;             // this frame's, in the order they were first set
+    int                         m_cameraIndex     = 0;
+    eRenderLayer                m_layer           = eRenderLayer::WORLD;
+    AABB2                       m_cullBounds;
+    int                         m_numCulled       = 0;
+    sRenderState                m_boundState;          // as Flush last sent it
+    std::vector<Vertex_PCU>     m_meshVerts;           // every registered mesh back to back, never changed after registering
+    std::vector<sInstancedMesh> m_meshes;
+    std::vector<sShapeInstance> m_instances;           // this frame's, in submission order
+    std::vector<sInstanceRun>   m_instanceRuns;
+    int                         m_numPlacedRuns   = 0; // runs before this have their verts' room in m_verts
+    sRenderBatcherStats         m_lastFrameStats;
+    int                         m_numGrowths      = 0;
+};
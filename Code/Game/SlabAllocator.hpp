@@ -0,0 +1,148 @@
+//----------------------------------------------------------------------------------------------------
+// SlabAllocator.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+//----------------------------------------------------------------------------------------------------
+#include <cstddef>
+#include <new>
+#include <vector>
+
+//----------------------------------------------------------------------------------------------------
+struct sSlabAllocatorStats
+{
+    int m_numSlabs               = 0;
+    int m_numBlocksReserved      = 0;
+    int m_numBlocksInUse         = 0;
+    int m_peakBlocksInUse        = 0;
+    int m_numAllocations         = 0;
+    int m_numFrees               = 0;
+    int m_numGrowthsAfterReserve = 0; // slabs added on demand; should stay 0 if the reserve was sized right
+};
+
+//----------------------------------------------------------------------------------------------------
+// Fixed-size block allocator for a single type.
+// Reserve requests one contiguous slab covering the expected peak; freed blocks are threaded onto an
+// intrusive free list and handed back out by the next Allocate, so Allocate/Free never touch the
+// general-purpose heap unless the reserve is exceeded, in which case it grows by BLOCKS_PER_SLAB.
+//
+template <typename T>
+class SlabAllocator
+{
+public:
+    static constexpr int BLOCKS_PER_SLAB = 256;
+
+    SlabAllocator() = default;
+    ~SlabAllocator();
+
+    SlabAllocator(SlabAllocator const&)            = delete;
+    SlabAllocator& operator=(SlabAllocator const&) = delete;
+
+    void  Reserve(int numBlocks);
+    void* Allocate();
+    void  Free(void* block);
+
+    sSlabAllocatorStats const& GetStats() const;
+
+private:
+    union uBlock
+    {
+        uBlock* m_next;
+        alignas(T) unsigned char m_storage[sizeof(T)];
+    };
+
+    void AddSlab(int numBlocks);
+
+    std::vector<uBlock*> m_slabs;
+    uBlock*              m_freeList   = nullptr;
+    bool                 m_isReserved = false;
+    sSlabAllocatorStats  m_stats;
+};
+
+//----------------------------------------------------------------------------------------------------
+template <typename T>
+SlabAllocator<T>::~SlabAllocator()
+{
+    for (uBlock* slab : m_slabs)
+    {
+        ::operator delete(slab, std::align_val_t{alignof(uBlock)});
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename T>
+void SlabAllocator<T>::Reserve(int const numBlocks)
+{
+    if (numBlocks > m_stats.m_numBlocksReserved)
+    {
+        AddSlab(numBlocks - m_stats.m_numBlocksReserved);
+    }
+
+    m_isReserved = true;
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename T>
+void* SlabAllocator<T>::Allocate()
+{
+    if (m_freeList == nullptr)
+    {
+        if (m_isReserved) ++m_stats.m_numGrowthsAfterReserve;
+
+        AddSlab(BLOCKS_PER_SLAB);
+    }
+
+    uBlock* block = m_freeList;
+    m_freeList    = block->m_next;
+
+    ++m_stats.m_numAllocations;
+    ++m_stats.m_numBlocksInUse;
+
+    if (m_stats.m_numBlocksInUse > m_stats.m_peakBlocksInUse)
+    {
+        m_stats.m_peakBlocksInUse = m_stats.m_numBlocksInUse;
+    }
+
+    return block->m_storage;
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename T>
+void SlabAllocator<T>::Free(void* block)
+{
+    if (block == nullptr) return;
+
+    uBlock* freedBlock = static_cast<uBlock*>(block);
+    freedBlock->m_next = m_freeList;
+    m_freeList         = freedBlock;
+
+    ++m_stats.m_numFrees;
+    --m_stats.m_numBlocksInUse;
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename T>
+sSlabAllocatorStats const& SlabAllocator<T>::GetStats() const
+{
+    return m_stats;
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename T>
+void SlabAllocator<T>::AddSlab(int const numBlocks)
+{
+    uBlock* slab = static_cast<uBlock*>(::operator new(sizeof(uBlock) * numBlocks, std::align_val_t{alignof(uBlock)}));
+
+    // Thread the new blocks onto the free list back to front so they are handed out in address order
+    for (int blockIndex = numBlocks - 1; blockIndex >= 0; --blockIndex)
+    {
+        slab[blockIndex].m_next = m_freeList;
+        m_freeList              = &slab[blockIndex];
+    }
+
+    m_slabs.push_back(slab);
+
+    ++m_stats.m_numSlabs;
+    m_stats.m_numBlocksReserved += numBlocks;
+}
@@ -0,0 +1,150 @@
+//----------------------------------------------------------------------------------------------------
+// SweepAndPrune.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/SweepAndPrune.hpp"
+//----------------------------------------------------------------------------------------------------
+#include <algorithm>
+
+//----------------------------------------------------------------------------------------------------
+SweepAndPrune::SweepAndPrune(int const maxEntries)
+{
+    m_entries.reserve(maxEntries);
+    m_sortedEntries.resize(maxEntries);
+    m_mergedEntries.resize(maxEntries);
+    m_sortedMinsX.resize(maxEntries);
+    m_sortedCentersX.resize(maxEntries);
+    m_sortedCentersY.resize(maxEntries);
+    m_sortedRadii.resize(maxEntries);
+    m_entryByRank.reserve(maxEntries);
+    m_newEntries.reserve(maxEntries);
+}
+
+//----------------------------------------------------------------------------------------------------
+void SweepAndPrune::Clear()
+{
+    m_entries.clear();
+
+    m_maxEntryRadius = 0.f;
+    m_numCandidatesVisited.store(0, std::memory_order_relaxed);
+}
+
+//----------------------------------------------------------------------------------------------------
+void SweepAndPrune::Insert(sBroadphaseEntry const& entry)
+{
+    m_entries.push_back(entry);
+
+    if (entry.m_radius > m_maxEntryRadius) m_maxEntryRadius = entry.m_radius;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Survivors go back in last frame's order, which is nearly sorted when motion is coherent, so the
+// insertion sort only moves what actually overtook something. Newcomers (a wave spawning, the first
+// frame) have no useful order, so they are sorted on their own and merged in.
+//
+void SweepAndPrune::Build()
+{
+    int const numEntries = static_cast<int>(m_entries.size());
+
+    if (static_cast<int>(m_sortedEntries.size()) < numEntries)
+    {
+        m_sortedEntries.resize(numEntries);
+        m_mergedEntries.resize(numEntries);
+        m_sortedMinsX.resize(numEntries);
+        m_sortedCentersX.resize(numEntries);
+        m_sortedCentersY.resize(numEntries);
+        m_sortedRadii.resize(numEntries);
+    }
+
+    m_entryByRank.assign(m_numPreviousEntries, -1);
+    m_newEntries.clear();
+
+    for (int entryIndex = 0; entryIndex < numEntries; ++entryIndex)
+    {
+        EntityHandle const handle      = m_entries[entryIndex].m_handle;
+        int const          handleIndex = handle.GetIndex();
+        bool const         isKnown     = handleIndex < static_cast<int>(m_previousHandles.size()) &&
+                                         m_previousHandles[handleIndex] == handle &&
+                                         m_previousRanks[handleIndex] < m_numPreviousEntries &&
+                                         m_entryByRank[m_previousRanks[handleIndex]] == -1;
+
+        if (isKnown) m_entryByRank[m_previousRanks[handleIndex]] = entryIndex;
+        else m_newEntries.push_back(entryIndex);
+    }
+
+    int numSorted = 0;
+
+    for (int const entryIndex : m_entryByRank)
+    {
+        if (entryIndex != -1) m_sortedEntries[numSorted++] = m_entries[entryIndex];
+    }
+
+    int const numSurvivors = numSorted;
+
+    m_numSortShifts = 0;
+
+    for (int sortedIndex = 0; sortedIndex < numSurvivors; ++sortedIndex)
+    {
+        sBroadphaseEntry const entry = m_sortedEntries[sortedIndex];
+        float const            minX  = GetMinX(entry);
+        int                    slot  = sortedIndex;
+
+        while (slot > 0 && GetMinX(m_sortedEntries[slot - 1]) > minX)
+        {
+            m_sortedEntries[slot] = m_sortedEntries[slot - 1];
+            --slot;
+        }
+
+        m_numSortShifts += sortedIndex - slot;
+
+        m_sortedEntries[slot] = entry;
+    }
+
+    if (!m_newEntries.empty())
+    {
+        for (int const entryIndex : m_newEntries)
+        {
+            m_sortedEntries[numSorted++] = m_entries[entryIndex];
+        }
+
+        auto const isLeftOf = [](sBroadphaseEntry const& a, sBroadphaseEntry const& b) { return GetMinX(a) < GetMinX(b); };
+
+        std::sort(m_sortedEntries.begin() + numSurvivors, m_sortedEntries.begin() + numEntries, isLeftOf);
+        std::merge(m_sortedEntries.begin(), m_sortedEntries.begin() + numSurvivors,
+                   m_sortedEntries.begin() + numSurvivors, m_sortedEntries.begin() + numEntries,
+                   m_mergedEntries.begin(), isLeftOf);
+        m_sortedEntries.swap(m_mergedEntries);
+    }
+
+    for (int sortedIndex = 0; sortedIndex < numEntries; ++sortedIndex)
+    {
+        sBroadphaseEntry const& entry       = m_sortedEntries[sortedIndex];
+        int const               handleIndex = entry.m_handle.GetIndex();
+
+        if (handleIndex >= static_cast<int>(m_previousHandles.size()))
+        {
+            m_previousHandles.resize(handleIndex + 1);
+            m_previousRanks.resize(handleIndex + 1, 0);
+        }
+
+        m_previousHandles[handleIndex] = entry.m_handle;
+        m_previousRanks[handleIndex]   = sortedIndex;
+
+        m_sortedMinsX[sortedIndex]    = GetMinX(entry);
+        m_sortedCentersX[sortedIndex] = entry.m_center.x;
+        m_sortedCentersY[sortedIndex] = entry.m_center.y;
+        m_sortedRadii[sortedIndex]    = entry.m_radius;
+    }
+
+    m_numPreviousEntries = numEntries;
+}
+
+//----------------------------------------------------------------------------------------------------
+size_t SweepAndPrune::GetNumBytesReserved() const
+{
+    return (m_entries.capacity() + m_sortedEntries.capacity() + m_mergedEntries.capacity()) * sizeof(sBroadphaseEntry) +
+           (m_sortedMinsX.capacity() + m_sortedCentersX.capacity() + m_sortedCentersY.capacity() + m_sortedRadii.capacity()) * sizeof(float) +
+           m_previousHandles.capacity() * sizeof(EntityHandle) +
+           (m_previousRanks.capacity() + m_entryByRank.capacity() + m_newEntries.capacity()) * sizeof(int);
+}
@@ -0,0 +1,194 @@
+//----------------------------------------------------------------------------------------------------
+// SweepAndPrune.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+//----------------------------------------------------------------------------------------------------
+#include "Game/Broadphase.hpp"
+#include "Game/CollisionKernels.hpp"
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Math/Vec2.hpp"
+//----------------------------------------------------------------------------------------------------
+#include <algorithm>
+#include <atomic>
+#include <cfloat>
+#include <cmath>
+#include <vector>
+
+//----------------------------------------------------------------------------------------------------
+// Sort-and-sweep broadphase on the x axis.
+// Entries are kept sorted by the left end of their x interval. Build() starts from the order the
+// previous Build() left behind (matched by EntityHandle) and repairs it with an insertion sort, so
+// when things only drift a little per frame, re-sorting costs about one pass instead of n log n.
+//
+// A query binary-searches the run of entries whose x interval can reach its own and sweeps that run,
+// handing overlaps to the caller as it finds them. Unlike CollisionGrid nothing wraps, and the run
+// ignores y entirely, so it suits scenes spread out along x rather than stacked in columns.
+//
+class SweepAndPrune
+{
+public:
+    explicit SweepAndPrune(int maxEntries);
+
+    void Clear(); // forgets this frame's entries but keeps their order as the next Build()'s hint
+    void Insert(sBroadphaseEntry const& entry);
+    void Build(); // sorts everything inserted since Clear(); call once before querying
+
+    // 'func' is called as func(sBroadphaseEntry const&) for every entry that may overlap the disc
+    template <typename Func>
+    void ForEachCandidate(Vec2 const& center, float radius, Func&& func) const;
+
+    // Same, narrowed to entries that do overlap it by the batched disc kernel, in ascending x order
+    template <typename Func>
+    void ForEachOverlap(Vec2 const& center, float radius, Func&& func) const;
+
+    // 'func' is called as func(sBroadphaseEntry const&) for every entry that may touch a disc swept
+    // from 'start' by 'displacement': the run under the sweep's whole x range
+    template <typename Func>
+    void ForEachCandidateAlongSegment(Vec2 const& start, Vec2 const& displacement, float radius, Func&& func) const;
+
+    // Same contract as CollisionGrid::FindNearest
+    template <typename Filter>
+    int FindNearest(Vec2 const& center, float maxDistance, int maxNeighbors, sBroadphaseNeighbor* out_neighbors, Filter&& filter) const;
+
+    int    GetNumEntries() const { return static_cast<int>(m_entries.size()); }
+    int    GetNumCandidatesVisited() const { return m_numCandidatesVisited.load(std::memory_order_relaxed); } // since the last Clear()
+    int    GetNumSortShifts() const { return m_numSortShifts; }               // insertion-sort moves of survivors in the last Build()
+    size_t GetNumBytesReserved() const;
+
+private:
+    static float GetMinX(sBroadphaseEntry const& entry) { return entry.m_center.x - entry.m_radius; }
+
+    // 'func' is called once as func(int firstEntry, int endEntry) with the run that can reach the disc
+    template <typename Func>
+    void ForEachRunInReach(Vec2 const& center, float radius, Func&& func) const;
+
+    float m_maxEntryRadius     = 0.f;
+    int   m_numPreviousEntries = 0;
+    int   m_numSortShifts      = 0;
+
+    std::vector<sBroadphaseEntry> m_entries;        // insertion order
+    std::vector<sBroadphaseEntry> m_sortedEntries;  // ascending m_sortedMinsX
+    std::vector<sBroadphaseEntry> m_mergedEntries;  // merge target when newcomers join; swapped with m_sortedEntries
+    std::vector<float>            m_sortedMinsX;    // left end of each sorted entry's x interval
+    std::vector<float>            m_sortedCentersX; // m_sortedEntries' shapes, packed for the kernels
+    std::vector<float>            m_sortedCentersY;
+    std::vector<float>            m_sortedRadii;
+    std::vector<EntityHandle>     m_previousHandles; // by handle index: who held m_previousRanks' rank
+    std::vector<int>              m_previousRanks;   // by handle index: sorted position after the last Build()
+    std::vector<int>              m_entryByRank;     // entry in m_entries that held each previous rank, or -1
+    std::vector<int>              m_newEntries;      // entries with no previous rank, appended after the rest
+
+    mutable std::atomic<int> m_numCandidatesVisited = 0; // queries may run on several threads at once
+};
+
+//----------------------------------------------------------------------------------------------------
+template <typename Func>
+void SweepAndPrune::ForEachCandidate(Vec2 const& center, float const radius, Func&& func) const
+{
+    ForEachRunInReach(center, radius, [this, &func](int const firstEntry, int const endEntry)
+    {
+        for (int entryIndex = firstEntry; entryIndex < endEntry; ++entryIndex)
+        {
+            func(m_sortedEntries[entryIndex]);
+        }
+    });
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename Func>
+void SweepAndPrune::ForEachOverlap(Vec2 const& center, float const radius, Func&& func) const
+{
+    ForEachRunInReach(center, radius, [this, &center, radius, &func](int const firstEntry, int const endEntry)
+    {
+        ForEachDiscOverlappingDisc(center, radius,
+                                   m_sortedCentersX.data() + firstEntry,
+                                   m_sortedCentersY.data() + firstEntry,
+                                   m_sortedRadii.data() + firstEntry,
+                                   endEntry - firstEntry,
+                                   [this, firstEntry, &func](int const index)
+        {
+            func(m_sortedEntries[firstEntry + index]);
+        });
+    });
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename Func>
+void SweepAndPrune::ForEachCandidateAlongSegment(Vec2 const& start, Vec2 const& displacement, float const radius, Func&& func) const
+{
+    // The run only depends on x, so the sweep's x extent is queried as one wide disc
+    float const minX = std::min(start.x, start.x + displacement.x);
+    float const maxX = std::max(start.x, start.x + displacement.x);
+
+    ForEachCandidate(Vec2((minX + maxX) * 0.5f, start.y), (maxX - minX) * 0.5f + radius, func);
+}
+
+//----------------------------------------------------------------------------------------------------
+// Walks outward from the center's place in the x order, always taking whichever side's next entry
+// could be nearer. On the right a center is at least minX - center.x away; on the left at least
+// center.x - minX - 2 * m_maxEntryRadius. Both only grow as the walk goes on, so it stops as soon as
+// the smaller of the two is past maxDistance, or past the farthest neighbor kept once the buffer is full.
+//
+template <typename Filter>
+int SweepAndPrune::FindNearest(Vec2 const& center, float const maxDistance, int const maxNeighbors, sBroadphaseNeighbor* out_neighbors, Filter&& filter) const
+{
+    if (maxNeighbors <= 0) return 0;
+
+    float const* const minsX = m_sortedMinsX.data();
+    int const          count = static_cast<int>(m_entries.size());
+
+    int right         = static_cast<int>(std::lower_bound(minsX, minsX + count, center.x) - minsX);
+    int left          = right - 1;
+    int numNeighbors  = 0;
+    int numCandidates = 0;
+
+    while (left >= 0 || right < count)
+    {
+        float const rightBound = right < count ? minsX[right] - center.x : FLT_MAX;
+        float const leftBound  = left >= 0 ? std::max(0.f, center.x - minsX[left] - 2.f * m_maxEntryRadius) : FLT_MAX;
+        float const bound      = std::min(leftBound, rightBound);
+
+        if (bound > maxDistance) break;
+        if (numNeighbors == maxNeighbors && bound >= out_neighbors[numNeighbors - 1].m_distance) break;
+
+        int const   entryIndex = rightBound <= leftBound ? right++ : left--;
+        float const offsetX    = m_sortedCentersX[entryIndex] - center.x;
+        float const offsetY    = m_sortedCentersY[entryIndex] - center.y;
+        float const distance   = std::sqrt(offsetX * offsetX + offsetY * offsetY);
+
+        ++numCandidates;
+
+        if (distance > maxDistance) continue;
+        if (numNeighbors == maxNeighbors && distance >= out_neighbors[numNeighbors - 1].m_distance) continue;
+
+        sBroadphaseEntry const& entry = m_sortedEntries[entryIndex];
+
+        if (!filter(entry)) continue;
+
+        numNeighbors = InsertNearestNeighbor(out_neighbors, numNeighbors, maxNeighbors, {entry.m_center, distance, entry.m_handle, entry.m_kind});
+    }
+
+    m_numCandidatesVisited.fetch_add(numCandidates, std::memory_order_relaxed);
+
+    return numNeighbors;
+}
+
+//----------------------------------------------------------------------------------------------------
+// An entry's interval is at most 2 * m_maxEntryRadius wide, so any that reaches the query starts no
+// further left than that from the query's own left end.
+//
+template <typename Func>
+void SweepAndPrune::ForEachRunInReach(Vec2 const& center, float const radius, Func&& func) const
+{
+    float const* const minsX = m_sortedMinsX.data();
+    int const          count = static_cast<int>(m_entries.size());
+
+    int const firstEntry = static_cast<int>(std::lower_bound(minsX, minsX + count, center.x - radius - 2.f * m_maxEntryRadius) - minsX);
+    int const endEntry   = static_cast<int>(std::upper_bound(minsX + firstEntry, minsX + count, center.x + radius) - minsX);
+
+    m_numCandidatesVisited.fetch_add(endEntry - firstEntry, std::memory_order_relaxed);
+
+    if (firstEntry < endEntry) func(firstEntry, endEntry);
+}
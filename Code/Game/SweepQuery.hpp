@@ -0,0 +1,97 @@
+//----------------------------------------------------------------------------------------------------
+// SweepQuery.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+//----------------------------------------------------------------------------------------------------
+#include "Game/EcsComponents.hpp"
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Math/AABB2.hpp"
+#include "Engine/Math/Vec2.hpp"
+//----------------------------------------------------------------------------------------------------
+#include <cmath>
+#include <cstdint>
+
+//----------------------------------------------------------------------------------------------------
+// A disc of m_radius pushed from m_start along m_direction for up to m_maxLength, e.g. a beam or a
+// line of sight with some thickness. A radius of 0 makes it a raycast.
+//
+struct sSweepQuery
+{
+    Vec2  m_start;
+    Vec2  m_direction;        // unit length
+    float m_maxLength = 0.f;
+    float m_radius    = 0.f;
+};
+
+//----------------------------------------------------------------------------------------------------
+enum class eSweepHitKind : uint8_t
+{
+    NONE,
+    ENEMY,
+    BOX
+};
+
+//----------------------------------------------------------------------------------------------------
+// Where a sweep first touched one target. The position is the disc's center at that moment, so for
+// a raycast it is the point on the target's surface.
+//
+struct sSweepHit
+{
+    Vec2          m_position;
+    Vec2          m_normal;                        // unit length, pointing out of the target
+    float         m_distance   = 0.f;              // along the query's direction, 0 if it started overlapping
+    EntityHandle  m_entity;                        // ENEMY hits
+    eEntityKind   m_entityKind = eEntityKind::NUM;
+    uint16_t      m_boxColumn  = 0;                // sBoxWallCell of BOX hits
+    uint8_t       m_boxRow     = 0;
+    eSweepHitKind m_kind       = eSweepHitKind::NONE;
+};
+
+//----------------------------------------------------------------------------------------------------
+// Builds the hit at 'hitFraction' of the query's full length against a disc centered on 'center'.
+// A sweep that starts inside the disc's center gets the normal facing back along the query.
+//
+inline sSweepHit MakeSweepHitOnDisc(sSweepQuery const& query, float const hitFraction, Vec2 const& center)
+{
+    sSweepHit hit;
+    hit.m_distance = hitFraction * query.m_maxLength;
+    hit.m_position = query.m_start + query.m_direction * hit.m_distance;
+
+    Vec2 const offset = hit.m_position - center;
+
+    hit.m_normal = offset.GetLengthSquared() > 0.f ? offset.GetNormalized() : -query.m_direction;
+
+    return hit;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Same against a box. When the contact is on the box's surface (always, for a raycast) the normal is
+// that of the face it lies on, picked by which side the contact is furthest out on relative to the
+// box's half size.
+//
+inline sSweepHit MakeSweepHitOnAABB(sSweepQuery const& query, float const hitFraction, AABB2 const& bounds)
+{
+    sSweepHit hit;
+    hit.m_distance = hitFraction * query.m_maxLength;
+    hit.m_position = query.m_start + query.m_direction * hit.m_distance;
+
+    Vec2 const offset = hit.m_position - bounds.GetNearestPoint(hit.m_position);
+
+    if (offset.GetLengthSquared() > 1e-8f)
+    {
+        hit.m_normal = offset.GetNormalized();
+        return hit;
+    }
+
+    Vec2 const  center   = bounds.GetCenter();
+    Vec2 const  halfSize = bounds.GetDimensions() * 0.5f;
+    float const scaledX  = (hit.m_position.x - center.x) / halfSize.x;
+    float const scaledY  = (hit.m_position.y - center.y) / halfSize.y;
+
+    if (std::fabs(scaledX) >= std::fabs(scaledY)) hit.m_normal = Vec2(scaledX >= 0.f ? 1.f : -1.f, 0.f);
+    else hit.m_normal = Vec2(0.f, scaledY >= 0.f ? 1.f : -1.f);
+
+    return hit;
+}
@@ -6,14 +6,16 @@
 #include "Game/UIHandler.hpp"
 //----------------------------------------------------------------------------------------------------
 #include "Game/Game.hpp"
+#include "Game/RenderBatcher.hpp"
 //----------------------------------------------------------------------------------------------------
 #include "Engine/Core/DevConsole.hpp"
 #include "Engine/Core/EngineCommon.hpp"
 #include "Engine/Core/SimpleTriangleFont.hpp"
 #include "Engine/Input/InputSystem.hpp"
 #include "Engine/Math/MathUtils.hpp"
-#include "Engine/Renderer/Renderer.hpp"
 #include "Engine/Renderer/VertexUtils.hpp"
+//----------------------------------------------------------------------------------------------------
+#include <algorithm>
 
 //----------------------------------------------------------------------------------------------------
 UIHandler::UIHandler(Game* game)
@@ -28,6 +30,16 @@ UIHandler::UIHandler(Game* game)
     InitializeAttractModeButtons();
 }
 
+//----------------------------------------------------------------------------------------------------
+void UIHandler::Reset()
+{
+    m_shiningTime         = 0.f;
+    m_selectedButtonIndex = 0;
+    m_playerShipName.clear();
+
+    InitializeAttractModeButtons();
+}
+
 //----------------------------------------------------------------------------------------------------
 void UIHandler::Update(double const deltaSeconds)
 {
@@ -124,7 +136,7 @@ void UIHandler::UpdateButtonSelection()
 }
 
 //-----------------------------------------------------------------------------------------------
-void UIHandler::DrawAttractModeUI() const
+void UIHandler::DrawAttractModeUI(RenderBatcher& batcher) const
 {
     float spacingX = 160.f;
     float spacingY = 160.f;
@@ -152,7 +164,7 @@ void UIHandler::DrawAttractModeUI() const
 
             Rgba8 drawColor = Rgba8(102, 153, 204, static_cast<unsigned char>(255 * gradientEffect));
 
-            DrawPlayerShip(Vec2(deltaX, deltaY), drawColor, 40.f);
+            DrawPlayerShip(batcher, Vec2(deltaX, deltaY), drawColor, 40.f);
         }
 
         std::vector<Vertex_PCU> titleShadowVerts;
@@ -174,7 +186,7 @@ void UIHandler::DrawAttractModeUI() const
                                    true,
                                    0.3f);
 
-        g_renderer->DrawVertexArray(static_cast<int>(titleShadowVerts.size()), titleShadowVerts.data());
+        DrawTextVerts(batcher, titleShadowVerts);
 
         std::vector<Vertex_PCU> titleVerts;
         AddVertsForTextTriangles2D(titleVerts,
@@ -193,13 +205,7 @@ void UIHandler::DrawAttractModeUI() const
                                    1.f,
                                    true,
                                    0.3f);
-        g_renderer->SetModelConstants();
-        g_renderer->SetBlendMode(eBlendMode::ALPHA);
-        g_renderer->SetRasterizerMode(eRasterizerMode::SOLID_CULL_NONE);
-        g_renderer->SetSamplerMode(eSamplerMode::POINT_CLAMP);
-        g_renderer->SetDepthMode(eDepthMode::DISABLED);
-        g_renderer->BindTexture(nullptr);
-        g_renderer->DrawVertexArray(static_cast<int>(titleVerts.size()), titleVerts.data());
+        DrawTextVerts(batcher, titleVerts);
 
         for (int buttonIndex = 0; buttonIndex < 2; ++buttonIndex)
         {
@@ -214,7 +220,10 @@ void UIHandler::DrawAttractModeUI() const
                 m_attractModeButtons[buttonIndex]->color = Rgba8(100, 100, 100);
             }
 
-            DebugDrawGlowBox(m_attractModeButtons[buttonIndex]->center,
+            batcher.SetLayer(eRenderLayer::UI_BACKGROUND);
+            DebugDrawGlowBox(batcher,
+                             UI_RENDER_STATE,
+                             m_attractModeButtons[buttonIndex]->center,
                              Vec2(m_attractModeButtons[buttonIndex]->width, m_attractModeButtons[buttonIndex]->height),
                              m_attractModeButtons[buttonIndex]->color,
                              1.f);
@@ -229,16 +238,17 @@ void UIHandler::DrawAttractModeUI() const
                                        true,
                                        0.3f);
 
-            g_renderer->DrawVertexArray(static_cast<int>(buttonTextVerts.size()), buttonTextVerts.data());
+            DrawTextVerts(batcher, buttonTextVerts);
         }
     }
 }
 
 //-----------------------------------------------------------------------------------------------
-void UIHandler::DrawInGameUI(int currentPlayerShipHealth) const
+void UIHandler::DrawInGameUI(RenderBatcher& batcher, int currentPlayerShipHealth) const
 {
-    DebugDrawGlowBox(Vec2(SCREEN_SIZE_X / 2.f, SCREEN_SIZE_Y - 30.f), Vec2(SCREEN_SIZE_X, 60.f), Rgba8(0, 0, 0), 1.f);
-    DebugDrawGlowBox(Vec2(SCREEN_SIZE_X / 2.f, 30.f), Vec2(SCREEN_SIZE_X, 60.f), Rgba8(0, 0, 0), 1.f);
+    batcher.SetLayer(eRenderLayer::UI_BACKGROUND);
+    DebugDrawGlowBox(batcher, UI_RENDER_STATE, Vec2(SCREEN_SIZE_X / 2.f, SCREEN_SIZE_Y - 30.f), Vec2(SCREEN_SIZE_X, 60.f), Rgba8(0, 0, 0), 1.f);
+    DebugDrawGlowBox(batcher, UI_RENDER_STATE, Vec2(SCREEN_SIZE_X / 2.f, 30.f), Vec2(SCREEN_SIZE_X, 60.f), Rgba8(0, 0, 0), 1.f);
 
     for (int playerShipHealth = 0; playerShipHealth < currentPlayerShipHealth; playerShipHealth++)
     {
@@ -246,12 +256,12 @@ void UIHandler::DrawInGameUI(int currentPlayerShipHealth) const
         float initialOffsetX = 4.f * 8.f;
         float delta          = initialOffsetX + static_cast<float>(playerShipHealth) * spacing;
 
-        DrawPlayerShip(Vec2(delta, 96.f * 8.f), PLAYER_SHIP_COLOR, 8.f);
+        DrawPlayerShip(batcher, Vec2(delta, 96.f * 8.f), PLAYER_SHIP_COLOR, 8.f);
     }
 
     std::vector<Vertex_PCU> titleVerts;
     AddVertsForTextTriangles2D(titleVerts,
-                               m_playerShipName + "/SCORE:" + std::to_string(m_game->GetPlayerShip()->m_score) +
+                               m_playerShipName + "/SCORE:" + std::to_string(m_game->GetPlayerScore()) +
                                "/HI:" + std::to_string(m_game->GetHighScore()),
                                Vec2(50.f, 0.f),
                                50.f,
@@ -260,13 +270,15 @@ void UIHandler::DrawInGameUI(int currentPlayerShipHealth) const
                                true,
                                0.3f);
 
-    g_renderer->DrawVertexArray(static_cast<int>(titleVerts.size()), titleVerts.data());
+    DrawTextVerts(batcher, titleVerts);
 }
 
 //-----------------------------------------------------------------------------------------------
-void UIHandler::DrawPlayerShip(Vec2 const& drawPosition, Rgba8 const& color, float scale) const
+void UIHandler::DrawPlayerShip(RenderBatcher& batcher, Vec2 const& drawPosition, Rgba8 const& color, float scale) const
 {
-    Vertex_PCU tempWorldVerts[PLAYER_SHIP_VERTS_NUM];
+    batcher.SetLayer(eRenderLayer::UI_BACKGROUND);
+
+    Vertex_PCU* tempWorldVerts = batcher.Append(UI_RENDER_STATE, PLAYER_SHIP_VERTS_NUM);
 
     for (int vertIndex = 0; vertIndex < PLAYER_SHIP_VERTS_NUM; vertIndex++)
     {
@@ -276,8 +288,16 @@ void UIHandler::DrawPlayerShip(Vec2 const& drawPosition, Rgba8 const& color, flo
     }
 
     TransformVertexArrayXY3D(PLAYER_SHIP_VERTS_NUM, tempWorldVerts, scale, 90.f, drawPosition);
+}
+
+//-----------------------------------------------------------------------------------------------
+void UIHandler::DrawTextVerts(RenderBatcher& batcher, std::vector<Vertex_PCU> const& textVerts) const
+{
+    batcher.SetLayer(eRenderLayer::UI_FOREGROUND);
+
+    Vertex_PCU* verts = batcher.Append(UI_RENDER_STATE, static_cast<int>(textVerts.size()));
 
-    g_renderer->DrawVertexArray(PLAYER_SHIP_VERTS_NUM, tempWorldVerts);
+    std::copy(textVerts.begin(), textVerts.end(), verts);
 }
 
 //-----------------------------------------------------------------------------------------------
@@ -339,12 +359,12 @@ void UIHandler::InitializeAttractModeButtons() const
 }
 
 
-void UIHandler::DrawPlayerNameInput() const
+void UIHandler::DrawPlayerNameInput(RenderBatcher& batcher) const
 {
     std::vector<Vertex_PCU> textVerts;
     AddVertsForTextTriangles2D(textVerts, m_playerShipName, Vec2(150.f, 600.f), 100.f, WASP_COLOR, 1.f,
                                true, 0.3f);
-    g_renderer->DrawVertexArray(static_cast<int>(textVerts.size()), textVerts.data());
+    DrawTextVerts(batcher, textVerts);
 }
 
 bool UIHandler::IsFirstButtonSelected() const
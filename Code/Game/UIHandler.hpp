@@ -9,10 +9,13 @@
 //----------------------------------------------------------------------------------------------------
 #include "Engine/Core/StringUtils.hpp"
 #include "Engine/Renderer/Vertex_PCU.hpp"
+//----------------------------------------------------------------------------------------------------
+#include <vector>
 
 //----------------------------------------------------------------------------------------------------
 struct Button;
 class Game;
+class RenderBatcher;
 
 //----------------------------------------------------------------------------------------------------
 class UIHandler
@@ -20,15 +23,19 @@ class UIHandler
 public:
     explicit UIHandler(Game* game);
 
+    void Reset();
+
     void Update(double deltaSeconds);
     void ConfirmPlayerName() const;
     void HandleKeyboardInput();
     void UpdateButtonSelection();
 
-    void DrawAttractModeUI() const;
-    void DrawInGameUI(int currentPlayerShipHealth) const;
+    // Draws are queued on 'batcher' under the camera it has set. Text goes on the foreground layer,
+    // so it stays in front of the ships and boxes however the queue groups them.
+    void DrawAttractModeUI(RenderBatcher& batcher) const;
+    void DrawInGameUI(RenderBatcher& batcher, int currentPlayerShipHealth) const;
 
-    void   DrawPlayerNameInput() const;
+    void   DrawPlayerNameInput(RenderBatcher& batcher) const;
     bool   IsFirstButtonSelected() const;
     bool   IsSecondButtonSelected() const;
     String GetPlayerShipName();
@@ -36,7 +43,8 @@ public:
 private:
     void InitializePlayerShipLocalVerts();
     void InitializeAttractModeButtons() const;
-    void DrawPlayerShip(Vec2 const& drawPosition, Rgba8 const& color, float scale) const;
+    void DrawPlayerShip(RenderBatcher& batcher, Vec2 const& drawPosition, Rgba8 const& color, float scale) const;
+    void DrawTextVerts(RenderBatcher& batcher, std::vector<Vertex_PCU> const& textVerts) const;
 
     Vertex_PCU m_localVerts[PLAYER_SHIP_VERTS_NUM];
     float      m_shiningTime;
@@ -0,0 +1,101 @@
+//----------------------------------------------------------------------------------------------------
+// WorkerPool.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/WorkerPool.hpp"
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Core/EngineCommon.hpp"
+//----------------------------------------------------------------------------------------------------
+#include <algorithm>
+
+//----------------------------------------------------------------------------------------------------
+WorkerPool::WorkerPool(int const numThreads)
+{
+    for (int threadIndex = 1; threadIndex < numThreads; ++threadIndex)
+    {
+        m_threads.emplace_back(&WorkerPool::WorkerMain, this);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+WorkerPool::~WorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_isShuttingDown = true;
+    }
+
+    m_wakeCondition.notify_all();
+
+    for (std::thread& thread : m_threads)
+    {
+        thread.join();
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC int WorkerPool::GetDefaultNumThreads()
+{
+    return std::max(1, static_cast<int>(std::thread::hardware_concurrency()) - 2);
+}
+
+//----------------------------------------------------------------------------------------------------
+// Every worker checks in for every dispatch, even one that finds no task left, so the task function
+// and its context are never touched after this returns.
+//
+void WorkerPool::Dispatch(int const numTasks, TaskFunction const taskFunction, void* context)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_taskFunction   = taskFunction;
+        m_taskContext    = context;
+        m_numTasks       = numTasks;
+        m_numBusyWorkers = static_cast<int>(m_threads.size());
+        m_nextTask.store(0, std::memory_order_relaxed);
+        ++m_dispatchIndex;
+    }
+
+    m_wakeCondition.notify_all();
+
+    RunTasks();
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_doneCondition.wait(lock, [this] { return m_numBusyWorkers == 0; });
+}
+
+//----------------------------------------------------------------------------------------------------
+void WorkerPool::RunTasks()
+{
+    for (int taskIndex = m_nextTask.fetch_add(1, std::memory_order_relaxed);
+         taskIndex < m_numTasks;
+         taskIndex = m_nextTask.fetch_add(1, std::memory_order_relaxed))
+    {
+        m_taskFunction(m_taskContext, taskIndex);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void WorkerPool::WorkerMain()
+{
+    uint64_t lastDispatchIndex = 0;
+
+    for (;;)
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wakeCondition.wait(lock, [this, lastDispatchIndex] { return m_isShuttingDown || m_dispatchIndex != lastDispatchIndex; });
+
+            if (m_isShuttingDown) return;
+
+            lastDispatchIndex = m_dispatchIndex;
+        }
+
+        RunTasks();
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (--m_numBusyWorkers == 0) m_doneCondition.notify_one();
+    }
+}
@@ -0,0 +1,79 @@
+//----------------------------------------------------------------------------------------------------
+// WorkerPool.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+//----------------------------------------------------------------------------------------------------
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+//----------------------------------------------------------------------------------------------------
+// Fork-join pool for splitting one frame's work across a fixed number of threads.
+// The calling thread is one of them, so a pool of 1 spawns nothing and runs every task inline.
+// Tasks are claimed from a shared counter, so which thread runs which task varies from run to run;
+// callers that need a deterministic result give every task its own output and merge by task index.
+//
+class WorkerPool
+{
+public:
+    explicit WorkerPool(int numThreads);
+    ~WorkerPool();
+
+    WorkerPool(WorkerPool const&)            = delete;
+    WorkerPool& operator=(WorkerPool const&) = delete;
+
+    // Calls func(int taskIndex) for every index in [0, numTasks) and returns once all have finished
+    template <typename Func>
+    void ParallelFor(int numTasks, Func&& func);
+
+    int GetNumThreads() const { return static_cast<int>(m_threads.size()) + 1; }
+
+    static int GetDefaultNumThreads(); // hardware threads minus two, like the engine's JobSystem, at least 1
+
+private:
+    using TaskFunction = void (*)(void* context, int taskIndex);
+
+    void Dispatch(int numTasks, TaskFunction taskFunction, void* context);
+    void RunTasks();
+    void WorkerMain();
+
+    std::vector<std::thread> m_threads;
+    std::mutex               m_mutex;
+    std::condition_variable  m_wakeCondition;
+    std::condition_variable  m_doneCondition;
+    TaskFunction             m_taskFunction   = nullptr;
+    void*                    m_taskContext    = nullptr;
+    int                      m_numTasks       = 0;
+    std::atomic<int>         m_nextTask       = 0;
+    int                      m_numBusyWorkers = 0; // guarded by m_mutex
+    uint64_t                 m_dispatchIndex  = 0; // guarded by m_mutex; bumped once per dispatch
+    bool                     m_isShuttingDown = false;
+};
+
+//----------------------------------------------------------------------------------------------------
+template <typename Func>
+void WorkerPool::ParallelFor(int const numTasks, Func&& func)
+{
+    if (m_threads.empty() || numTasks <= 1)
+    {
+        for (int taskIndex = 0; taskIndex < numTasks; ++taskIndex)
+        {
+            func(taskIndex);
+        }
+
+        return;
+    }
+
+    TaskFunction const taskFunction = [](void* context, int const taskIndex)
+    {
+        (*static_cast<std::remove_reference_t<Func>*>(context))(taskIndex);
+    };
+
+    Dispatch(numTasks, taskFunction, &func);
+}